@@ -0,0 +1,78 @@
+#include "include/Render.hh"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace easy;
+
+static std::vector<uint8_t> buffer(800 * 480 * 4);
+
+static uint8_t* BufferData() {
+	return buffer.data();
+}
+
+static int BufferFormat() {
+	return static_cast<int>(PixelFormat::BGRA8888);
+}
+
+static int BufferStride() {
+	return 800 * 4;
+}
+
+static void LegacyFilledRect(Rect r, Color c) {
+	Rect t = r.ClipTo(Size{ 800, 480 });
+	if (t.Empty()) return;
+	uint8_t* data = buffer.data();
+	size_t line_size = 800 * size_t(4);
+	for (int i = t.Left; i < t.Right; ++i) {
+		for (int j = t.Top; j < t.Bottom; ++j) {
+			Renderer::FillPixel(data + (j * line_size + i * size_t(4)), c);
+		}
+	}
+}
+
+template<typename F>
+static double FillRate(Rect r, F&& fill) {
+	long long pixels = 0;
+	int rounds = 0;
+	Color c = Colors::Blue;
+	auto begin = std::chrono::steady_clock::now();
+	auto end = begin;
+	do {
+		for (int i = 0; i < 64; ++i) {
+			c.Red = static_cast<uint8_t>(rounds + i);
+			fill(r, c);
+		}
+		pixels += 64LL * (r.Right - r.Left) * (r.Bottom - r.Top);
+		++rounds;
+		end = std::chrono::steady_clock::now();
+	} while (end - begin < std::chrono::milliseconds(500));
+	return pixels / std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+int main() {
+	int width = 800, height = 480;
+	Renderer::RegisterData(BufferData);
+	Renderer::RegisterFormat(BufferFormat);
+	Renderer::RegisterStride(BufferStride);
+	Renderer::RegisterSize(width, height);
+
+	const struct {
+		const char* name;
+		Rect rect;
+	} cases[] = {
+		{ "full screen 800x480", { 0, 0, 800, 480 } },
+		{ "button 76x76", { 100, 100, 176, 176 } },
+		{ "border 800x5", { 0, 200, 800, 205 } },
+		{ "border 5x480", { 200, 0, 205, 480 } },
+		{ "cell 30x30", { 13, 17, 43, 47 } },
+	};
+
+	printf("span kernel: %s\n", Span::Name());
+	printf("%-22s %14s %14s %9s\n", "rect", "before Mpx/s", "after Mpx/s", "speedup");
+	for (auto& c : cases) {
+		double before = FillRate(c.rect, LegacyFilledRect);
+		double after = FillRate(c.rect, Renderer::DrawFilledRect);
+		printf("%-22s %14.1f %14.1f %8.2fx\n", c.name, before, after, after / before);
+	}
+}
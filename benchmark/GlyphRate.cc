@@ -0,0 +1,161 @@
+#include "include/Render.hh"
+#include "font/font.cc"
+#include "font/spans.cc"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace easy;
+
+static std::vector<uint8_t> buffer(800 * 480 * 4);
+
+static uint8_t* BufferData() {
+	return buffer.data();
+}
+
+static int BufferFormat() {
+	return static_cast<int>(PixelFormat::BGRA8888);
+}
+
+static int BufferStride() {
+	return 800 * 4;
+}
+
+static void LegacyByMask(Rect r, Color c, const uint8_t* mask, Size shape) {
+	Rect t = r.ClipTo(Size{ 800, 480 });
+	if (t.Empty()) return;
+	uint8_t* data = buffer.data();
+	size_t line_size = 800 * size_t(4);
+	for (int i = t.Left; i < t.Right && i < r.Left + shape.Width; ++i) {
+		for (int j = t.Top; j < t.Bottom && j < r.Top + shape.Height; ++j) {
+			int index = (i - r.Left) + (j - r.Top) * ((shape.Width + 7) / 8 * 8);
+			if ((mask[index / 8] >> (7 - (index % 8))) & 0x1) {
+				Renderer::FillPixel(data + (j * line_size + i * size_t(4)), c);
+			}
+		}
+	}
+}
+
+struct MaskRuns {
+	uint8_t Count;
+	uint8_t Begin[4];
+	uint8_t End[4];
+
+	static constexpr std::array<MaskRuns, 256> Build() {
+		std::array<MaskRuns, 256> table = {};
+		for (int bits = 0; bits < 256; ++bits) {
+			MaskRuns runs = {};
+			for (int k = 0; k < 8;) {
+				if (!(bits & (0x80 >> k))) { ++k; continue; }
+				runs.Begin[runs.Count] = static_cast<uint8_t>(k);
+				while (k < 8 && (bits & (0x80 >> k))) ++k;
+				runs.End[runs.Count++] = static_cast<uint8_t>(k);
+			}
+			table[bits] = runs;
+		}
+		return table;
+	}
+};
+
+static constexpr std::array<MaskRuns, 256> mask_runs = MaskRuns::Build();
+
+template<int Width>
+static void RasterMask(const RenderTarget& target, Rect r, Color c, const uint8_t* mask, Size shape) {
+	Rect t = r.ClipTo(target.Area).ClipTo(Renderer::Clip()).ClipTo(Rect::BaseOn({ r.Left, r.Top }, shape));
+	if (t.Empty()) return;
+	constexpr int fixed_pitch = (Width + 7) / 8;
+	const int pitch = Width ? fixed_pitch : (shape.Width + 7) / 8;
+	const int first = (t.Left - r.Left) / 8, last = (t.Right - r.Left + 7) / 8;
+	Pos origin = { target.Area.Left, target.Area.Top };
+	WithPixelFormat(target.Format, [&](auto format) {
+		using F = decltype(format);
+		const uint8_t* row = mask + (t.Top - r.Top) * pitch;
+		for (int j = t.Top; j < t.Bottom; ++j, row += pitch) {
+			uint8_t* line = target.Line(j);
+			for (int b = first; b < last; ++b) {
+				if (!row[b]) continue;
+				const MaskRuns& runs = mask_runs[row[b]];
+				int base = r.Left + b * 8;
+				for (int k = 0; k < runs.Count; ++k) {
+					int left = std::max(base + runs.Begin[k], t.Left);
+					int right = std::min(base + runs.End[k], t.Right);
+					if (left < right) Renderer::Paint<F>(line, left - origin.X, right - origin.X, j - origin.Y, c);
+				}
+			}
+		}
+	});
+}
+
+static void ByteMask(Rect r, Color c, const uint8_t* mask, Size shape) {
+	c = Renderer::Premultiply(c);
+	if (c.Alpha == 0xFF) return;
+	RenderTarget target = Renderer::Current();
+	switch (shape.Width) {
+	case 8: return RasterMask<8>(target, r, c, mask, shape);
+	case 10: return RasterMask<10>(target, r, c, mask, shape);
+	case 12: return RasterMask<12>(target, r, c, mask, shape);
+	case 14: return RasterMask<14>(target, r, c, mask, shape);
+	case 16: return RasterMask<16>(target, r, c, mask, shape);
+	case 20: return RasterMask<20>(target, r, c, mask, shape);
+	case 24: return RasterMask<24>(target, r, c, mask, shape);
+	default: return RasterMask<0>(target, r, c, mask, shape);
+	}
+}
+
+static void SpanGlyph(const Font& font, Rect r, Color c, char ch) {
+	const Glyph* glyph = font.Find(ch);
+	if (glyph && glyph->Count) Renderer::DrawSpans({ r.Left, r.Top }, c, font.Spans + glyph->First, glyph->Count);
+}
+
+template<typename F>
+static double GlyphRate(int size, F&& draw) {
+	Size shape = { size / 2, size };
+	long long glyphs = 0;
+	auto begin = std::chrono::steady_clock::now();
+	auto end = begin;
+	do {
+		Pos pos = { 0, 0 };
+		for (int ch = 32; ch < 127; ++ch) {
+			draw(Rect::BaseOn(pos, shape), Colors::Black, ch);
+			pos.X += shape.Width;
+			if (pos.X + shape.Width > 800) pos = { 0, pos.Y + shape.Height };
+		}
+		glyphs += 127 - 32;
+		end = std::chrono::steady_clock::now();
+	} while (end - begin < std::chrono::milliseconds(300));
+	return glyphs / std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+int main() {
+	int width = 800, height = 480;
+	Renderer::RegisterData(BufferData);
+	Renderer::RegisterFormat(BufferFormat);
+	Renderer::RegisterStride(BufferStride);
+	Renderer::RegisterSize(width, height);
+
+	const struct {
+		const char* name;
+		const uint8_t* data;
+		const Font& spans;
+		int size;
+	} fonts[] = {
+		{ "font16", font16::data, spans16::font, 16 },
+		{ "font20", font20::data, spans20::font, 20 },
+		{ "font24", font24::data, spans24::font, 24 },
+		{ "font28", font28::data, spans28::font, 28 },
+		{ "font32", font32::data, spans32::font, 32 },
+		{ "font40", font40::data, spans40::font, 40 },
+		{ "font48", font48::data, spans48::font, 48 },
+	};
+
+	printf("%-8s %16s %16s %16s\n", "font", "legacy Mglyph/s", "mask Mglyph/s", "spans Mglyph/s");
+	for (auto& f : fonts) {
+		Size shape = { f.size / 2, f.size };
+		int cell = (shape.Width + 7) / 8 * shape.Height;
+		double legacy = GlyphRate(f.size, [&](Rect r, Color c, char ch) { LegacyByMask(r, c, f.data + ch * cell, shape); });
+		double mask = GlyphRate(f.size, [&](Rect r, Color c, char ch) { ByteMask(r, c, f.data + ch * cell, shape); });
+		double spans = GlyphRate(f.size, [&](Rect r, Color c, char ch) { SpanGlyph(f.spans, r, c, ch); });
+		printf("%-8s %16.2f %16.2f %16.2f\n", f.name, legacy, mask, spans);
+	}
+}
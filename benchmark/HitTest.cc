@@ -0,0 +1,64 @@
+#include "include/OverlapPanel.hh"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace easy;
+
+template<typename F>
+static double Rate(F&& run) {
+	long long count = 0;
+	auto begin = std::chrono::steady_clock::now();
+	auto end = begin;
+	do {
+		for (int i = 0; i < 64; ++i) run();
+		count += 64;
+		end = std::chrono::steady_clock::now();
+	} while (end - begin < std::chrono::milliseconds(300));
+	return std::chrono::duration<double, std::nano>(end - begin).count() / count;
+}
+
+int main() {
+	const int pitch = 40, size = 36;
+	std::mt19937 engine(7);
+	bool passed = true;
+
+	printf("%-9s %14s %14s %9s %11s %11s\n", "elements", "linear ns/hit", "indexed ns/hit", "speedup", "arrange us", "indexed us");
+	for (int count : { 100, 1000, 10000 }) {
+		int cols = 1;
+		while (cols * cols < count) ++cols;
+		Size area = { cols * pitch, (count + cols - 1) / cols * pitch };
+		OverlapPanel panel = MakeOverlapPanel();
+		panel->SpecSize = area;
+		for (int i = 0; i < count; ++i) {
+			Element e = MakeElement();
+			e->SpecSize = { size, size };
+			e->Margin = { i % cols * pitch, i / cols * pitch, 0, 0 };
+			panel->Add(e);
+		}
+
+		std::uniform_int_distribution<int> x(-pitch, area.Width + pitch), y(-pitch, area.Height + pitch);
+		std::vector<Pos> points;
+		for (int i = 0; i < 4096; ++i) points.push_back({ x(engine), y(engine) });
+		size_t next = 0;
+
+		panel->Measure(area);
+		panel->Arrange({ 0, 0 }, area);
+		std::vector<std::pair<Element, int>> expected;
+		for (Pos p : points) expected.push_back(panel->MouseTarget(p));
+		double linear = Rate([&]() { panel->MouseTarget(points[next++ & 4095]); });
+		double plain = Rate([&]() { panel->Arrange({ 0, 0 }, area); });
+
+		panel->Indexed = true;
+		panel->Arrange({ 0, 0 }, area);
+		for (size_t i = 0; i < points.size(); ++i)
+			if (panel->MouseTarget(points[i]) != expected[i]) passed = false;
+		double indexed = Rate([&]() { panel->MouseTarget(points[next++ & 4095]); });
+		double arrange = Rate([&]() { panel->Arrange({ 0, 0 }, area); });
+
+		printf("%-9d %14.1f %14.1f %8.1fx %11.1f %11.1f\n", count, linear, indexed, linear / indexed, plain / 1000, arrange / 1000);
+	}
+	printf("results %s\n", passed ? "match" : "DIFFER");
+	return passed ? 0 : 1;
+}
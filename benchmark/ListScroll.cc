@@ -0,0 +1,88 @@
+#include "include/ListPanel.hh"
+#include "include/OverlapPanel.hh"
+#include "include/Label.hh"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using namespace easy;
+
+template<typename F>
+static double Rate(F&& run) {
+	long long count = 0;
+	auto begin = std::chrono::steady_clock::now();
+	auto end = begin;
+	do {
+		for (int i = 0; i < 16; ++i) run();
+		count += 16;
+		end = std::chrono::steady_clock::now();
+	} while (end - begin < std::chrono::milliseconds(300));
+	return std::chrono::duration<double, std::micro>(end - begin).count() / count;
+}
+
+int main() {
+	const int pitch = 40;
+	const Size area = { 400, 300 };
+	bool passed = true;
+
+	printf("%-9s %14s %14s %9s %9s\n", "items", "overlap us", "list us", "speedup", "created");
+	for (int count : { 100, 1000, 10000 }) {
+		int scroll = 0;
+		OverlapPanel panel = MakeOverlapPanel();
+		panel->ClipToBounds = true;
+		for (int i = 0; i < count; ++i) {
+			Label item = MakeLabel();
+			item->SpecSize = { area.Width, pitch };
+			item->Text = std::to_string(i);
+			panel->Add(item);
+		}
+		double overlap = Rate([&]() {
+			scroll = (scroll + 7) % (count * pitch - area.Height);
+			auto [begin, end] = panel->GetRange();
+			for (int i = 0; begin != end; ++i, ++begin) (*begin)->Margin.Top = i * pitch - scroll;
+			panel->Measure(area);
+			panel->Arrange({ 0, 0 }, area);
+			panel->CollectDamage(true);
+		});
+
+		int created = 0;
+		ListPanel list = MakeListPanel(
+			pitch,
+			[&]() {
+				Label item = MakeLabel();
+				item->SpecSize = { area.Width, pitch };
+				++created;
+				return Element(item);
+			},
+			[](const Element& elem, size_t index) { std::static_pointer_cast<_Label>(elem)->Text = std::to_string(index); }
+		);
+		list->Count = count;
+		auto frame = [&]() {
+			list->Measure(area);
+			list->Arrange({ 0, 0 }, area);
+			list->CollectDamage(true);
+		};
+		for (int step : { 13, 173 })
+			for (int offset = 0; offset < count * pitch; offset += step) {
+				list->Offset = offset;
+				frame();
+				int top = std::min(offset, count * pitch - area.Height);
+				for (int y = pitch / 2 - top % pitch; y < area.Height; y += pitch) {
+					if (y < 0) continue;
+					auto hit = list->MouseTarget({ area.Width / 2, y });
+					std::string text = std::to_string((top + y) / pitch);
+					if (!hit.first || hit.second || std::static_pointer_cast<_Label>(hit.first)->Text != text) passed = false;
+				}
+			}
+		scroll = 0;
+		double virtualized = Rate([&]() {
+			list->Offset = scroll = (scroll + 7) % (count * pitch - area.Height);
+			frame();
+		});
+
+		if (created != static_cast<int>(list->Capacity())) passed = false;
+		printf("%-9d %14.1f %14.1f %8.1fx %9d\n", count, overlap, virtualized, overlap / virtualized, created);
+	}
+	printf("bindings %s\n", passed ? "match" : "STALE");
+	return passed ? 0 : 1;
+}
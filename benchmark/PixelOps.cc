@@ -0,0 +1,43 @@
+#include "include/Span.hh"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace easy;
+
+template<typename F>
+static double Rate(size_t count, F&& run) {
+	long long pixels = 0;
+	auto begin = std::chrono::steady_clock::now();
+	auto end = begin;
+	do {
+		for (int i = 0; i < 16; ++i) run();
+		pixels += 16LL * count;
+		end = std::chrono::steady_clock::now();
+	} while (end - begin < std::chrono::milliseconds(200));
+	return pixels / std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+int main() {
+	const size_t count = 800 * 480;
+	std::vector<uint32_t> dst(count), from(count, 0x20406080), to(count, 0xa0c0e0ff);
+	bool passed = true;
+
+	printf("selected: %s\n", Span::Name());
+	printf("%-8s %9s %12s %12s %12s %12s %12s %12s\n", "kernels", "selftest", "fill Mpx/s", "copy Mpx/s", "stream Mpx/s", "blend Mpx/s", "lerp Mpx/s", "scale Mpx/s");
+	for (const SpanKernels& k : Span::Variants()) {
+		bool ok = Span::SelfTest(k);
+		passed &= ok;
+		double fill = Rate(count, [&]() { k.Fill(dst.data(), 0x80402010, count); });
+		double copy = Rate(count, [&]() { k.Copy(dst.data(), from.data(), count); });
+		double stream = Rate(count, [&]() {
+			k.Stream(reinterpret_cast<uint8_t*>(dst.data()), reinterpret_cast<const uint8_t*>(from.data()), count * 4);
+			Span::Flush();
+		});
+		double blend = Rate(count, [&]() { k.Blend(dst.data(), 0x00402010, 0x80, count); });
+		double lerp = Rate(count, [&]() { k.Lerp(dst.data(), from.data(), to.data(), 0x60, count); });
+		double scale = Rate(count, [&]() { k.Scale(dst.data(), from.data(), 0xc0, count); });
+		printf("%-8s %9s %12.1f %12.1f %12.1f %12.1f %12.1f %12.1f\n", k.Name, ok ? "pass" : "FAIL", fill, copy, stream, blend, lerp, scale);
+	}
+	return passed ? 0 : 1;
+}
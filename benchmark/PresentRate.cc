@@ -0,0 +1,72 @@
+#include "system/Present.hh"
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <chrono>
+#include <cstdio>
+
+struct Case {
+	const char* name;
+	int left, top, right, bottom;
+};
+
+template<typename F>
+static double Bandwidth(const Case& c, long bytes, F&& copy) {
+	long long copied = 0;
+	auto begin = std::chrono::steady_clock::now();
+	auto end = begin;
+	do {
+		for (int i = 0; i < 16; ++i) copy(c);
+		copied += 16LL * (c.right - c.left) * bytes * (c.bottom - c.top);
+		end = std::chrono::steady_clock::now();
+	} while (end - begin < std::chrono::milliseconds(500));
+	return copied / std::chrono::duration<double, std::micro>(end - begin).count();
+}
+
+int main(int argc, char* argv[]) {
+	int width = 800, height = 480;
+	long bytes = 4, stride = width * bytes;
+	uint8_t* target = nullptr;
+	PresentEngine destination;
+	if (argc > 1) {
+		int fp = open(argv[1], O_RDWR);
+		fb_var_screeninfo vinfo = {};
+		fb_fix_screeninfo finfo = {};
+		if (fp < 0 || ioctl(fp, FBIOGET_FSCREENINFO, &finfo) || ioctl(fp, FBIOGET_VSCREENINFO, &vinfo))
+			printf("Error: Fail to open framebuffer %s\n", argv[1]), exit(1);
+		width = vinfo.xres, height = vinfo.yres;
+		bytes = vinfo.bits_per_pixel / 8, stride = finfo.line_length;
+		target = static_cast<uint8_t*>(mmap(0, stride * height, PROT_READ | PROT_WRITE, MAP_SHARED, fp, 0));
+		if (target == MAP_FAILED) printf("Error: Failed to map framebuffer to memory\n"), exit(1);
+	} else {
+		destination.allocate(stride, height, bytes);
+		target = destination.shadow;
+	}
+
+	PresentEngine engine;
+	engine.allocate(stride, height, bytes);
+	for (long i = 0; i < stride * height; ++i) engine.shadow[i] = static_cast<uint8_t>(i * 7);
+
+	const Case cases[] = {
+		{ "full screen", 0, 0, width, height },
+		{ "half screen", 0, height / 4, width, height * 3 / 4 },
+		{ "button 76x76", 100, 100, 176, 176 },
+		{ "border 800x5", 0, 200, width, 205 },
+		{ "border 5x480", 200, 0, 205, height },
+	};
+
+	printf("target: %s %dx%d %ld bpp, span kernel: %s\n", argc > 1 ? argv[1] : "memory", width, height, bytes * 8, easy::Span::Name());
+	printf("%-16s %14s %14s %9s\n", "region", "memcpy MB/s", "stream MB/s", "speedup");
+	for (const Case& c : cases) {
+		double before = Bandwidth(c, bytes, [&](const Case& c) {
+			long offset = c.top * stride + c.left * bytes;
+			for (int j = c.top; j < c.bottom; ++j, offset += stride)
+				memcpy(target + offset, engine.shadow + offset, (c.right - c.left) * bytes);
+		});
+		double after = Bandwidth(c, bytes, [&](const Case& c) {
+			engine.copy(target, stride, c.left, c.top, c.right, c.bottom);
+		});
+		printf("%-16s %14.1f %14.1f %8.2fx\n", c.name, before, after, after / before);
+	}
+}
@@ -38,6 +38,7 @@ int main() {
 
 	Grid btns = MakeGrid({ 80,80,80,80 }, { 80,80,80,80 });
 	btns->Margin = { 20 };
+	btns->Cached = true;
 
 
 	auto MakeBtn = []() {
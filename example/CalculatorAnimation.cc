@@ -1,9 +1,11 @@
 #include "include/OverlapPanel.hh"
 #include "include/Grid.hh"
 #include "include/Label.hh"
+#include "include/ListPanel.hh"
 #include "system/SystemIO.hh"
 #include <iostream>
 #include <string>
+#include <vector>
 using namespace easy;
 
 int as_int(std::string s) {
@@ -24,62 +26,56 @@ int main() {
 	int result = 0;
 	bool wait_new = true;
 
-    OverlapPanel history = MakeOverlapPanel();
-    history->Margin = { 50, 0, 50, 50 };
-    auto add_history = [&](std::string info) {
-        Label item = MakeLabel();
-        item->Text = info;
-        item->FontHorizontalAlignment = HorizontalAlignType::Left;
-        item->SpecSize = { 340, 40 };
-        item->Margin.Top = 10;
-        item->BeginAnimation(
-            Element(item),
-            &_Element::BackgroundColor,
-            Color::FromARGB(0xE6E6E6),
-            Color::FromARGB(0xF0F0F0),
-            500,
-            EaseInOutCubic
-        );
-        item->BeginAnimation(
-            item,
-            &_Label::FontColor,
-            Color::FromARGB(0xE6E6E6),
-            Colors::Black,
-            500,
-            EaseInOutCubic
-        );
-        auto [begin, end] = history->GetRange();
-        int total = history->Capacity();
-        for (int i = 0; begin != end; ++i, ++begin) {
-            if (i > total - 6)
-                (*begin)->BeginAnimation(
-                    *begin,
-                    &_Element::Margin,
-                    (*begin)->Margin,
-                    Rect { 0, 60 + 50 * (total - 1 - i) },
+    std::vector<std::string> entries;
+    ListPanel history = MakeListPanel(
+        50,
+        []() {
+            Label item = MakeLabel();
+            item->FontHorizontalAlignment = HorizontalAlignType::Left;
+            item->SpecSize = { 340, 40 };
+            item->BackgroundColor = Color::FromARGB(0xF0F0F0);
+            item->FontColor = Colors::Black;
+            return Element(item);
+        },
+        [&](const Element& elem, size_t index) {
+            Label item = std::static_pointer_cast<_Label>(elem);
+            item->Text = entries[entries.size() - 1 - index];
+            if (index == 0) {
+                item->Margin = { 0, 10 };
+                item->BeginAnimation(
+                    elem,
+                    &_Element::BackgroundColor,
+                    Color::FromARGB(0xE6E6E6),
+                    Color::FromARGB(0xF0F0F0),
                     500,
                     EaseInOutCubic
                 );
-            else if (i == total - 6) {
-                (*begin)->BeginAnimation(
-                    std::dynamic_pointer_cast<_Label>(*begin),
+                item->BeginAnimation(
+                    item,
                     &_Label::FontColor,
-                    Colors::Black,
                     Color::FromARGB(0xE6E6E6),
+                    Colors::Black,
                     500,
                     EaseInOutCubic
                 );
-                (*begin)->BeginAnimation(
-                    *begin,
-                    &_Element::BackgroundColor,
-                    (*begin)->BackgroundColor,
-                    Color::FromARGB(0xE6E6E6),
+            } else {
+                item->Margin = { 0, -40 };
+                item->BeginAnimation(
+                    elem,
+                    &_Element::Margin,
+                    item->Margin,
+                    Rect { 0, 10 },
                     500,
                     EaseInOutCubic
                 );
             }
         }
-        history->Add(item);
+    );
+    history->Margin = { 50, 0, 50, 50 };
+    auto add_history = [&](std::string info) {
+        entries.push_back(info);
+        history->Count = entries.size();
+        history->Refresh();
     };
 	
 	Label input = MakeLabel();
@@ -280,6 +280,7 @@ int main() {
     g->VerticalAlignment = VerticalAlignType::Center;
     g->BackgroundColor = Color::FromARGB(0xF0F0F0);
     g->BorderColor = Colors::White;
+    g->ClipToBounds = true;
 
     Grid form = MakeGrid({ 0 }, { 550, 250 });
     form->BackgroundColor = Colors::White;
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "font/font.cc"
+
+struct Source {
+	int size;
+	const uint8_t* data;
+};
+
+struct Span {
+	int left, top, right, bottom;
+};
+
+static std::vector<Span> Trace(const uint8_t* cell, int width, int height) {
+	int pitch = (width + 7) / 8;
+	auto bit = [&](int x, int y) { return (cell[y * pitch + x / 8] >> (7 - x % 8)) & 0x1; };
+	std::vector<Span> spans;
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width;) {
+			if (!bit(x, y)) { ++x; continue; }
+			int left = x;
+			while (x < width && bit(x, y)) ++x;
+			auto open = std::find_if(spans.begin(), spans.end(), [&](const Span& s) {
+				return s.left == left && s.right == x && s.bottom == y;
+			});
+			if (open != spans.end()) ++open->bottom;
+			else spans.push_back({ left, y, x, y + 1 });
+		}
+	}
+	std::stable_sort(spans.begin(), spans.end(), [](const Span& a, const Span& b) { return a.top < b.top; });
+	return spans;
+}
+
+static void Compile(const Source& font, int first, int last) {
+	int width = font.size / 2, height = font.size;
+	int cell_size = (width + 7) / 8 * height;
+	std::vector<Span> spans;
+	printf("namespace spans%d {\n", font.size);
+	printf("const Glyph glyphs[] = {\n");
+	for (int c = first; c <= last; ++c) {
+		std::vector<Span> glyph = Trace(font.data + c * cell_size, width, height);
+		Span box = { 0, 0, 0, 0 };
+		if (!glyph.empty()) box = { width, height, 0, 0 };
+		for (const Span& s : glyph)
+			box = { std::min(box.left, s.left), std::min(box.top, s.top), std::max(box.right, s.right), std::max(box.bottom, s.bottom) };
+		printf("{%d,%d,%d,%d,%zu,%zu},\n", box.left, box.top, box.right, box.bottom, spans.size(), glyph.size());
+		spans.insert(spans.end(), glyph.begin(), glyph.end());
+	}
+	printf("};\n");
+	printf("const GlyphSpan spans[] = {\n");
+	for (size_t i = 0; i < spans.size(); ++i)
+		printf("{%d,%d,%d,%d},%s", spans[i].left, spans[i].top, spans[i].right, spans[i].bottom, i % 10 == 9 || i + 1 == spans.size() ? "\n" : "");
+	if (spans.empty()) printf("{0,0,0,0}\n");
+	printf("};\n");
+	printf("const Font font = { %d, %d, %d, %d, glyphs, spans };\n", width, height, first, last);
+	printf("}\n\n");
+}
+
+int main(int argc, char** argv) {
+	int first = 32, last = 126;
+	if (argc == 3) first = atoi(argv[1]), last = atoi(argv[2]);
+	if ((argc != 1 && argc != 3) || first < 0 || last > 127 || first > last)
+		return printf("usage: %s [first last] > font/spans.cc\n", argv[0]), 1;
+	const Source fonts[] = {
+		{ 16, easy::font16::data },
+		{ 20, easy::font20::data },
+		{ 24, easy::font24::data },
+		{ 28, easy::font28::data },
+		{ 32, easy::font32::data },
+		{ 40, easy::font40::data },
+		{ 48, easy::font48::data },
+	};
+	printf("// Generated by font/FontCompiler.cc from font16.c - font48.c. Do not edit.\n");
+	printf("#include \"include/Font.hh\"\n\n");
+	printf("namespace easy {\n\n");
+	for (const Source& font : fonts) Compile(font, first, last);
+	printf("}\n");
+}
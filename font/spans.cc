@@ -0,0 +1,1459 @@
+// Generated by font/FontCompiler.cc from font16.c - font48.c. Do not edit.
+#include "include/Font.hh"
+
+namespace easy {
+
+namespace spans16 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{3,3,5,13,0,2},
+{1,3,6,6,2,2},
+{0,4,7,13,4,10},
+{1,3,7,15,14,12},
+{0,3,8,13,26,17},
+{0,3,7,13,43,12},
+{3,3,5,6,55,1},
+{2,3,6,16,56,7},
+{1,3,5,16,63,7},
+{2,3,7,9,70,7},
+{0,6,7,13,77,3},
+{2,11,5,15,80,3},
+{2,9,6,10,83,1},
+{3,11,5,13,84,1},
+{1,3,7,14,85,8},
+{1,4,7,13,93,13},
+{2,4,7,13,106,5},
+{1,4,7,13,111,8},
+{1,4,6,13,119,5},
+{0,4,7,13,124,8},
+{1,4,6,13,132,6},
+{1,4,7,13,138,10},
+{1,4,7,13,148,6},
+{1,4,7,13,154,11},
+{1,4,7,13,165,10},
+{3,6,5,13,175,2},
+{2,6,5,15,177,4},
+{2,5,6,13,181,7},
+{1,8,7,11,188,2},
+{1,5,5,13,190,7},
+{2,3,6,13,197,6},
+{0,3,8,16,203,14},
+{0,4,7,13,217,10},
+{1,4,7,13,227,8},
+{1,4,7,13,235,7},
+{1,4,7,13,242,6},
+{1,4,6,13,248,5},
+{1,4,6,13,253,4},
+{0,4,6,13,257,8},
+{1,4,7,13,265,5},
+{1,4,6,13,270,3},
+{1,4,6,13,273,4},
+{1,4,7,13,277,11},
+{2,4,7,13,288,2},
+{1,4,7,13,290,7},
+{1,4,7,13,297,6},
+{0,4,7,13,303,8},
+{1,4,7,13,311,7},
+{0,4,7,15,318,10},
+{1,4,7,13,328,9},
+{1,4,7,13,337,7},
+{0,4,7,13,344,2},
+{1,4,7,13,346,4},
+{1,4,8,13,350,11},
+{1,4,8,13,361,10},
+{0,4,8,13,371,14},
+{0,4,7,13,385,7},
+{1,4,7,13,392,7},
+{3,3,6,16,399,3},
+{1,3,7,14,402,8},
+{2,3,5,16,410,3},
+{1,4,6,8,413,5},
+{0,15,8,16,418,1},
+{1,3,4,5,419,2},
+{1,6,6,13,421,8},
+{1,3,7,13,429,8},
+{1,6,6,13,437,5},
+{1,3,7,13,442,9},
+{1,6,7,13,451,9},
+{1,3,7,13,460,4},
+{1,6,7,16,464,9},
+{1,3,6,13,473,5},
+{1,3,7,13,478,4},
+{1,3,6,16,482,5},
+{1,3,6,13,487,9},
+{1,3,7,13,496,3},
+{0,6,7,13,499,6},
+{1,6,6,13,505,5},
+{1,6,7,13,510,8},
+{1,6,7,16,518,9},
+{1,6,7,16,527,8},
+{1,6,6,13,535,5},
+{1,6,6,13,540,5},
+{0,4,6,13,545,4},
+{1,6,6,13,549,5},
+{2,6,7,13,554,6},
+{0,6,7,13,560,7},
+{0,6,8,13,567,11},
+{1,6,7,16,578,9},
+{1,6,6,13,587,5},
+{1,3,6,16,592,5},
+{3,2,4,16,597,1},
+{2,3,7,16,598,5},
+{0,8,7,11,603,5},
+};
+const GlyphSpan spans[] = {
+{3,3,4,10},{3,11,5,13},{1,3,3,6},{4,3,6,6},{2,4,3,6},{5,4,6,6},{0,6,7,7},{2,7,3,8},{5,7,6,8},{1,8,2,9},
+{4,8,5,9},{0,9,7,10},{1,10,2,13},{4,10,5,13},{4,3,5,4},{2,4,6,5},{1,5,2,7},{4,5,5,6},{3,6,4,7},{1,7,4,8},
+{3,8,6,9},{3,9,4,12},{5,9,7,10},{6,10,7,12},{1,12,6,13},{3,13,4,15},{1,3,3,4},{6,3,7,4},{0,4,1,6},{3,4,4,5},
+{5,4,6,5},{3,5,6,6},{1,6,3,7},{4,6,5,7},{3,7,4,9},{2,9,3,10},{5,9,7,10},{1,10,3,11},{4,10,5,12},{7,10,8,12},
+{1,11,2,12},{0,12,1,13},{5,12,7,13},{2,3,4,4},{1,4,2,6},{4,4,5,6},{1,6,5,7},{2,7,4,8},{1,8,4,9},{5,8,6,10},
+{0,9,1,12},{3,9,4,10},{4,10,6,12},{1,12,4,13},{5,12,7,13},{3,3,5,6},{5,3,6,4},{4,4,5,5},{3,5,4,7},{2,7,3,12},
+{3,12,4,14},{4,14,5,15},{5,15,6,16},{1,3,2,4},{2,4,3,5},{3,5,4,7},{4,7,5,12},{3,12,4,14},{2,14,3,15},{1,15,2,16},
+{4,3,5,5},{2,4,3,5},{6,4,7,5},{3,5,6,7},{2,7,3,8},{4,7,5,9},{6,7,7,8},{3,6,4,9},{0,9,7,10},{3,10,4,13},
+{3,11,5,13},{4,13,5,14},{2,14,4,15},{2,9,6,10},{3,11,5,13},{6,3,7,4},{5,4,6,6},{4,6,6,7},{4,7,5,8},{3,8,5,9},
+{3,9,4,11},{2,11,3,13},{1,13,2,14},{2,4,6,5},{2,5,3,6},{5,5,6,6},{1,6,2,9},{6,6,7,7},{5,7,7,8},{3,8,5,9},
+{6,8,7,11},{1,9,3,10},{1,10,2,11},{2,11,3,12},{5,11,6,12},{2,12,6,13},{4,4,5,5},{3,5,5,6},{2,6,3,7},{4,6,5,12},
+{2,12,7,13},{2,4,6,5},{1,5,2,6},{6,5,7,8},{5,8,6,9},{4,9,6,10},{3,10,5,11},{2,11,4,12},{1,12,7,13},{1,4,5,5},
+{5,5,6,8},{2,8,5,9},{5,9,6,12},{1,12,5,13},{3,4,5,6},{2,6,3,7},{4,6,5,10},{1,7,3,8},{1,8,2,9},{0,9,1,10},
+{0,10,7,11},{4,11,5,13},{1,4,6,5},{1,5,2,8},{1,8,5,9},{5,9,6,11},{4,11,6,12},{1,12,5,13},{3,4,6,5},{2,5,3,6},
+{1,6,2,8},{3,7,6,8},{1,8,3,9},{6,8,7,11},{1,9,2,11},{1,11,3,12},{5,11,7,12},{2,12,6,13},{1,4,7,5},{6,5,7,6},
+{5,6,6,8},{4,8,5,10},{3,10,4,12},{2,12,4,13},{2,4,6,5},{1,5,2,7},{6,5,7,7},{1,7,3,8},{5,7,7,8},{3,8,5,9},
+{1,9,3,10},{5,9,7,10},{1,10,2,12},{6,10,7,12},{2,12,6,13},{2,4,6,5},{1,5,3,6},{5,5,7,6},{1,6,2,9},{6,6,7,8},
+{5,8,7,9},{2,9,5,10},{6,9,7,11},{5,11,6,12},{2,12,5,13},{3,6,5,8},{3,11,5,13},{3,6,5,8},{3,11,5,13},{4,13,5,14},
+{2,14,4,15},{5,5,6,6},{4,6,5,7},{3,7,4,8},{2,8,3,10},{3,10,4,11},{4,11,5,12},{5,12,6,13},{1,8,7,9},{1,10,7,11},
+{1,5,2,6},{2,6,3,7},{3,7,4,8},{4,8,5,10},{3,10,4,11},{2,11,3,12},{1,12,2,13},{2,3,4,4},{4,4,5,5},{5,5,6,8},
+{2,8,5,9},{2,9,3,10},{2,11,4,13},{3,3,6,4},{2,4,3,5},{6,4,7,5},{1,5,2,7},{7,5,8,12},{0,7,1,14},{3,7,6,8},
+{2,8,4,9},{5,8,6,12},{2,9,3,12},{2,12,7,13},{1,14,2,15},{5,14,6,15},{2,15,5,16},{3,4,5,5},{2,5,3,7},{4,5,5,7},
+{1,7,3,8},{4,7,6,8},{1,8,2,10},{5,8,6,10},{0,10,7,11},{0,11,1,13},{6,11,7,13},{1,4,6,5},{1,5,2,8},{6,5,7,7},
+{5,7,7,8},{1,8,6,9},{1,9,2,12},{6,9,7,12},{1,12,6,13},{3,4,6,5},{2,5,3,6},{6,5,7,6},{1,6,2,11},{2,11,3,12},
+{6,11,7,12},{3,12,6,13},{1,4,5,5},{1,5,2,12},{5,5,6,6},{6,6,7,11},{5,11,6,12},{1,12,5,13},{1,4,6,5},{1,5,2,8},
+{1,8,6,9},{1,9,2,12},{1,12,6,13},{1,4,6,5},{1,5,2,8},{1,8,6,9},{1,9,2,13},{2,4,5,5},{1,5,2,6},{5,5,6,6},
+{0,6,1,11},{3,8,6,9},{5,9,6,12},{1,11,2,12},{2,12,6,13},{1,4,2,8},{6,4,7,8},{1,8,7,9},{1,9,2,13},{6,9,7,13},
+{1,4,6,5},{3,5,4,12},{1,12,6,13},{1,4,6,5},{5,5,6,12},{1,11,2,12},{2,12,5,13},{1,4,2,8},{6,4,7,5},{5,5,6,6},
+{4,6,5,7},{3,7,4,8},{1,8,3,9},{1,9,2,13},{3,9,4,10},{4,10,5,11},{5,11,6,12},{6,12,7,13},{2,4,3,12},{2,12,7,13},
+{2,4,3,5},{5,4,7,6},{1,5,3,6},{1,6,2,13},{3,6,5,9},{6,6,7,13},{3,9,4,10},{1,4,3,6},{6,4,7,11},{1,6,2,13},
+{3,6,4,9},{4,9,5,11},{5,11,7,13},{2,4,5,5},{1,5,2,6},{5,5,6,6},{0,6,1,11},{6,6,7,11},{1,11,2,12},{5,11,6,12},
+{2,12,5,13},{1,4,6,5},{1,5,2,9},{5,5,7,6},{6,6,7,8},{5,8,7,9},{1,9,5,10},{1,10,2,13},{2,4,5,5},{1,5,2,6},
+{5,5,6,6},{0,6,1,11},{6,6,7,11},{1,11,2,12},{5,11,6,12},{1,12,5,13},{3,13,4,14},{4,14,7,15},{1,4,5,5},{1,5,2,8},
+{5,5,6,8},{1,8,5,9},{1,9,2,13},{4,9,5,10},{4,10,6,11},{5,11,6,12},{5,12,7,13},{2,4,6,5},{1,5,2,7},{1,7,3,8},
+{3,8,6,9},{5,9,7,10},{6,10,7,12},{1,12,6,13},{0,4,7,5},{3,5,4,13},{1,4,2,12},{6,4,7,11},{5,11,7,12},{2,12,6,13},
+{1,4,2,6},{7,4,8,6},{1,6,3,7},{6,6,8,7},{2,7,3,9},{6,7,7,9},{2,9,4,10},{5,9,7,10},{3,10,4,12},{5,10,6,12},
+{3,12,5,13},{1,4,2,7},{7,4,8,8},{1,7,3,9},{4,7,5,10},{6,8,8,9},{2,9,3,10},{6,9,7,11},{2,10,5,11},{2,11,4,13},
+{5,11,7,13},{0,4,2,5},{5,4,7,5},{1,5,3,6},{5,5,6,6},{2,6,3,7},{4,6,5,7},{3,7,5,9},{2,9,5,10},{2,10,3,11},
+{5,10,6,11},{1,11,2,12},{5,11,7,12},{0,12,2,13},{6,12,8,13},{0,4,1,5},{6,4,7,5},{1,5,2,7},{5,5,6,7},{2,7,3,9},
+{4,7,5,9},{3,9,4,13},{1,4,7,5},{5,5,6,7},{4,7,5,8},{3,8,5,9},{3,9,4,10},{2,10,3,12},{1,12,7,13},{3,3,6,4},
+{3,4,4,15},{3,15,6,16},{1,3,2,4},{2,4,3,6},{3,6,4,8},{3,8,5,9},{4,9,5,10},{4,10,6,11},{5,11,6,13},{6,13,7,14},
+{2,3,5,4},{4,4,5,15},{2,15,5,16},{3,4,4,5},{2,5,3,6},{4,5,5,6},{1,6,2,8},{5,6,6,8},{0,15,8,16},{1,3,3,4},
+{2,4,4,5},{3,6,5,7},{2,7,3,8},{5,7,6,9},{2,9,6,10},{1,10,2,12},{5,10,6,11},{4,11,6,12},{2,12,6,13},{1,3,2,7},
+{3,6,6,7},{1,7,3,8},{5,7,7,8},{1,8,2,12},{6,8,7,11},{5,11,6,12},{1,12,5,13},{2,6,6,7},{2,7,3,8},{1,8,2,11},
+{1,11,3,12},{2,12,6,13},{6,3,7,6},{3,6,7,7},{2,7,3,8},{6,7,7,11},{1,8,2,11},{1,11,3,12},{5,11,7,12},{2,12,5,13},
+{6,12,7,13},{2,6,6,7},{1,7,3,8},{5,7,7,8},{1,8,2,9},{6,8,7,9},{1,9,7,10},{1,10,2,11},{1,11,3,12},{2,12,7,13},
+{4,3,7,4},{3,4,4,7},{1,7,6,8},{3,8,4,13},{2,6,7,7},{1,7,2,10},{5,7,6,10},{1,10,5,11},{1,11,2,12},{1,12,6,13},
+{1,13,2,15},{6,13,7,15},{2,15,6,16},{1,3,2,7},{3,6,5,7},{1,7,3,8},{5,7,6,13},{1,8,2,13},{2,3,4,5},{1,6,4,7},
+{3,7,4,12},{1,12,7,13},{4,3,6,5},{1,6,6,7},{5,7,6,14},{4,14,6,15},{1,15,5,16},{1,3,2,9},{5,6,6,7},{4,7,5,8},
+{3,8,4,9},{1,9,3,10},{1,10,2,13},{3,10,4,11},{4,11,5,12},{5,12,6,13},{1,3,4,4},{3,4,4,12},{1,12,7,13},{0,6,7,7},
+{0,7,2,8},{3,7,5,8},{6,7,7,13},{0,8,1,13},{3,8,4,13},{1,6,2,7},{3,6,5,7},{1,7,3,8},{5,7,6,13},{1,8,2,13},
+{2,6,6,7},{1,7,3,8},{5,7,7,8},{1,8,2,11},{6,8,7,11},{1,11,3,12},{5,11,7,12},{2,12,6,13},{1,6,2,7},{3,6,6,7},
+{1,7,3,8},{5,7,7,8},{1,8,2,12},{6,8,7,11},{5,11,6,12},{1,12,5,13},{1,13,2,16},{3,6,7,7},{2,7,3,8},{6,7,7,11},
+{1,8,2,11},{1,11,3,12},{5,11,7,12},{2,12,5,13},{6,12,7,16},{1,6,2,7},{3,6,5,7},{1,7,3,8},{5,7,6,9},{1,8,2,13},
+{2,6,6,7},{1,7,2,9},{2,9,5,10},{5,10,6,12},{1,12,5,13},{2,4,3,6},{0,6,6,7},{2,7,3,12},{3,12,6,13},{1,6,2,12},
+{5,6,6,11},{4,11,6,12},{2,12,4,13},{5,12,6,13},{2,6,3,8},{6,6,7,9},{2,8,4,9},{3,9,4,12},{5,9,6,12},{4,12,5,13},
+{0,6,1,12},{6,6,7,12},{3,8,4,9},{2,9,3,12},{4,9,5,12},{1,12,2,13},{5,12,6,13},{1,6,3,7},{5,6,7,7},{2,7,3,8},
+{5,7,6,8},{3,8,5,10},{2,10,3,11},{5,10,6,11},{1,11,3,12},{5,11,7,12},{0,12,2,13},{6,12,8,13},{2,6,3,8},{6,6,7,8},
+{2,8,4,9},{5,8,7,9},{3,9,4,12},{5,9,6,12},{4,12,5,14},{3,14,4,15},{1,15,4,16},{1,6,6,7},{4,7,5,9},{3,9,4,10},
+{2,10,3,12},{1,12,6,13},{4,3,6,4},{3,4,4,9},{1,9,3,10},{3,10,4,15},{4,15,6,16},{3,2,4,16},{2,3,4,4},{4,4,5,9},
+{5,9,7,10},{4,10,5,15},{2,15,4,16},{1,8,3,9},{6,8,7,10},{0,9,1,11},{3,9,4,10},{4,10,6,11},
+};
+const Font font = { 8, 16, 32, 126, glyphs, spans };
+}
+
+namespace spans20 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{4,4,6,16,0,2},
+{2,4,7,8,2,2},
+{0,5,9,16,4,10},
+{1,4,8,18,14,14},
+{0,4,9,16,28,20},
+{0,4,9,16,48,16},
+{4,4,6,8,64,1},
+{3,4,7,19,65,11},
+{2,4,6,19,76,11},
+{1,4,8,11,87,9},
+{1,8,8,15,96,3},
+{2,14,6,19,99,4},
+{2,11,7,12,103,1},
+{3,14,6,16,104,1},
+{1,4,8,18,105,12},
+{1,5,8,16,117,14},
+{1,5,8,16,131,5},
+{1,5,8,16,136,10},
+{1,5,7,16,146,9},
+{0,5,9,16,155,11},
+{1,5,7,16,166,7},
+{1,5,8,16,173,12},
+{1,5,8,16,185,10},
+{1,5,8,16,195,15},
+{1,5,8,16,210,12},
+{3,8,5,16,222,2},
+{2,8,6,19,224,5},
+{1,7,7,16,229,9},
+{1,10,8,14,238,2},
+{2,7,8,16,240,9},
+{3,4,8,16,249,6},
+{0,4,9,19,255,20},
+{0,5,9,16,275,14},
+{1,5,8,16,289,11},
+{1,5,8,16,300,9},
+{1,5,8,16,309,8},
+{2,5,8,16,317,5},
+{2,5,8,16,322,4},
+{1,5,8,16,326,10},
+{1,5,8,16,336,5},
+{1,5,8,16,341,3},
+{2,5,7,16,344,5},
+{1,5,8,16,349,13},
+{2,5,8,16,362,2},
+{0,5,9,16,364,10},
+{1,5,8,16,374,9},
+{0,5,9,16,383,12},
+{1,5,8,16,395,7},
+{0,5,8,19,402,14},
+{1,5,8,16,416,12},
+{1,5,8,16,428,11},
+{1,5,8,16,439,2},
+{1,5,8,16,441,5},
+{0,5,9,16,446,15},
+{1,5,8,16,461,7},
+{0,5,9,16,468,19},
+{0,5,9,16,487,11},
+{1,5,8,16,498,11},
+{3,4,7,19,509,3},
+{1,4,8,18,512,12},
+{2,4,6,19,524,3},
+{1,5,8,10,527,8},
+{0,18,9,19,535,1},
+{2,4,5,6,536,2},
+{1,8,7,16,538,9},
+{1,4,8,16,547,8},
+{1,8,7,16,555,7},
+{1,4,8,16,562,9},
+{1,8,8,16,571,9},
+{1,4,8,16,580,5},
+{1,8,8,19,585,9},
+{1,4,7,16,594,5},
+{1,4,8,16,599,4},
+{1,4,7,19,603,6},
+{2,4,8,16,609,10},
+{1,4,8,16,619,3},
+{1,8,8,16,622,6},
+{1,8,7,16,628,5},
+{1,8,8,16,633,8},
+{1,8,8,19,641,9},
+{1,8,8,19,650,8},
+{2,8,8,16,658,5},
+{2,8,8,16,663,6},
+{1,5,9,16,669,6},
+{1,8,7,16,675,5},
+{1,8,8,16,680,11},
+{1,8,8,16,691,7},
+{1,8,9,16,698,14},
+{0,8,8,19,712,12},
+{1,8,7,16,724,8},
+{2,4,8,19,732,7},
+{4,2,5,19,739,1},
+{2,4,8,19,740,7},
+{1,10,9,13,747,5},
+};
+const GlyphSpan spans[] = {
+{4,4,5,13},{4,14,6,16},{2,4,4,8},{5,4,7,8},{2,5,3,8},{6,5,7,8},{0,8,9,9},{2,9,3,11},{6,9,7,11},{1,11,2,12},
+{5,11,6,12},{0,12,9,13},{1,13,2,16},{5,13,6,16},{4,4,6,6},{2,6,7,7},{1,7,3,8},{4,7,5,10},{1,8,2,9},{1,9,3,10},
+{2,10,5,11},{4,11,7,12},{3,12,5,14},{7,12,8,14},{3,14,4,15},{6,14,8,15},{1,15,7,16},{3,16,4,18},{1,4,3,5},{8,4,9,5},
+{0,5,1,8},{3,5,4,8},{7,5,8,6},{6,6,8,7},{6,7,7,8},{1,8,3,9},{5,8,6,9},{4,9,6,10},{4,10,5,11},{3,11,4,12},
+{6,11,8,12},{2,12,4,13},{5,12,6,15},{8,12,9,15},{2,13,3,14},{1,14,2,15},{0,15,2,16},{6,15,8,16},{2,4,5,5},{1,5,2,8},
+{5,5,6,8},{1,8,3,9},{4,8,5,9},{2,9,4,10},{1,10,5,11},{7,10,8,12},{0,11,1,14},{4,11,5,12},{4,12,8,13},{5,13,7,14},
+{0,14,2,15},{5,14,8,15},{1,15,5,16},{7,15,9,16},{4,4,6,8},{6,4,7,5},{5,5,6,6},{4,6,6,7},{4,7,5,8},{3,8,5,9},
+{3,9,4,14},{3,14,5,15},{4,15,5,16},{4,16,6,17},{5,17,6,18},{6,18,7,19},{2,4,3,5},{3,5,4,6},{3,6,5,7},{4,7,5,8},
+{4,8,6,9},{5,9,6,14},{4,14,6,15},{4,15,5,16},{3,16,5,17},{3,17,4,18},{2,18,3,19},{4,4,5,6},{1,5,2,6},{7,5,8,6},
+{2,6,7,7},{4,7,5,8},{2,8,7,9},{1,9,2,10},{4,9,5,11},{7,9,8,10},{4,8,5,11},{1,11,8,12},{4,12,5,15},{3,14,6,16},
+{4,16,6,17},{3,17,5,18},{2,18,4,19},{2,11,7,12},{3,14,6,16},{7,4,8,5},{6,5,8,6},{6,6,7,7},{5,7,7,8},{5,8,6,10},
+{4,10,6,11},{4,11,5,12},{3,12,5,13},{3,13,4,14},{2,14,4,15},{2,15,3,17},{1,17,3,18},{3,5,6,6},{2,6,3,7},{6,6,7,7},
+{1,7,2,12},{6,7,8,9},{5,9,6,10},{7,9,8,14},{4,10,5,11},{3,11,4,12},{1,12,3,13},{1,13,2,14},{2,14,3,15},{6,14,7,15},
+{3,15,6,16},{3,5,5,6},{2,6,3,7},{4,6,5,15},{1,7,2,8},{1,15,8,16},{2,5,6,6},{1,6,2,7},{5,6,7,7},{6,7,7,10},
+{5,10,6,11},{4,11,6,12},{3,12,5,13},{2,13,4,14},{2,14,3,15},{1,15,8,16},{1,5,6,6},{5,6,7,7},{6,7,7,9},{5,9,6,10},
+{2,10,6,11},{5,11,7,12},{6,12,7,14},{5,14,6,15},{1,15,5,16},{5,5,7,6},{4,6,7,7},{4,7,5,8},{6,7,7,13},{3,8,5,9},
+{2,9,4,10},{2,10,3,11},{1,11,2,12},{0,12,2,13},{0,13,9,14},{6,14,7,16},{1,5,6,6},{1,6,2,9},{1,9,5,10},{5,10,7,11},
+{6,11,7,14},{5,14,6,15},{1,15,5,16},{4,5,7,6},{2,6,4,7},{2,7,3,8},{1,8,2,10},{3,9,7,10},{1,10,3,11},{6,10,8,11},
+{1,11,2,14},{7,11,8,14},{2,14,3,15},{6,14,7,15},{3,15,6,16},{1,5,8,6},{6,6,8,7},{6,7,7,8},{5,8,7,9},{5,9,6,10},
+{4,10,6,12},{4,12,5,13},{3,13,5,14},{3,14,4,15},{2,15,4,16},{2,5,7,6},{1,6,3,7},{6,6,8,7},{1,7,2,9},{7,7,8,9},
+{2,9,4,10},{6,9,7,10},{3,10,6,11},{2,11,3,12},{6,11,7,12},{1,12,2,14},{7,12,8,14},{1,14,3,15},{6,14,8,15},{2,15,7,16},
+{3,5,6,6},{2,6,3,7},{6,6,7,7},{1,7,2,10},{7,7,8,10},{1,10,3,11},{6,10,8,11},{2,11,6,12},{7,11,8,13},{6,13,7,14},
+{5,14,7,15},{2,15,5,16},{3,8,5,10},{3,14,5,16},{3,8,5,10},{3,14,6,16},{4,16,6,17},{3,17,5,18},{2,18,4,19},{6,7,7,8},
+{4,8,6,9},{3,9,5,10},{2,10,4,11},{1,11,3,12},{2,12,4,13},{3,13,5,14},{4,14,6,15},{6,15,7,16},{1,10,8,11},{1,13,8,14},
+{2,7,3,8},{3,8,5,9},{4,9,6,10},{5,10,7,11},{6,11,8,12},{5,12,7,13},{4,13,6,14},{3,14,5,15},{2,15,3,16},{3,4,6,5},
+{6,5,7,6},{7,6,8,9},{4,9,7,10},{4,10,5,13},{4,14,6,16},{3,4,7,5},{2,5,4,6},{7,5,8,6},{1,6,3,7},{7,6,9,7},
+{1,7,2,9},{8,7,9,14},{4,8,7,9},{0,9,1,16},{3,9,4,10},{5,9,7,10},{2,10,3,14},{6,10,7,13},{5,13,7,14},{3,14,5,15},
+{6,14,8,15},{1,16,2,17},{1,17,3,18},{6,17,7,18},{2,18,6,19},{3,5,6,6},{3,6,4,8},{5,6,6,8},{2,8,4,9},{5,8,7,9},
+{2,9,3,11},{6,9,7,10},{6,10,8,12},{1,11,3,12},{1,12,8,13},{0,13,2,15},{7,13,9,15},{0,15,1,16},{8,15,9,16},{1,5,7,6},
+{1,6,2,10},{6,6,8,7},{7,7,8,9},{6,9,7,10},{1,10,7,11},{1,11,2,15},{6,11,8,12},{7,12,8,14},{6,14,8,15},{1,15,6,16},
+{3,5,7,6},{2,6,4,7},{7,6,8,7},{2,7,3,8},{1,8,2,13},{1,13,3,14},{2,14,4,15},{7,14,8,15},{3,15,7,16},{1,5,6,6},
+{1,6,2,15},{6,6,7,7},{6,7,8,8},{7,8,8,13},{6,13,7,14},{5,14,7,15},{1,15,6,16},{2,5,8,6},{2,6,3,10},{2,10,8,11},
+{2,11,3,15},{2,15,8,16},{2,5,8,6},{2,6,3,10},{2,10,8,11},{2,11,3,16},{3,5,7,6},{2,6,4,7},{7,6,8,7},{2,7,3,8},
+{1,8,2,13},{5,10,8,11},{7,11,8,15},{1,13,3,14},{2,14,4,15},{3,15,8,16},{1,5,2,10},{7,5,8,10},{1,10,8,11},{1,11,2,16},
+{7,11,8,16},{1,5,8,6},{4,6,5,15},{1,15,8,16},{2,5,7,6},{6,6,7,14},{2,14,3,15},{5,14,7,15},{3,15,6,16},{1,5,2,10},
+{7,5,8,6},{6,6,7,7},{5,7,6,8},{4,8,5,9},{3,9,4,10},{1,10,3,11},{1,11,2,16},{3,11,4,12},{4,12,5,13},{5,13,6,14},
+{6,14,7,15},{7,15,8,16},{2,5,3,15},{2,15,8,16},{0,5,2,6},{7,5,9,6},{0,6,3,8},{6,6,9,8},{0,8,4,9},{5,8,6,11},
+{7,8,9,16},{0,9,2,16},{3,9,4,11},{4,11,5,12},{1,5,3,7},{7,5,8,14},{1,7,2,16},{3,7,4,9},{3,9,5,10},{4,10,5,11},
+{4,11,6,12},{5,12,6,14},{6,14,8,16},{2,5,7,6},{1,6,3,7},{6,6,8,7},{1,7,2,8},{7,7,9,8},{0,8,1,13},{8,8,9,13},
+{0,13,2,14},{7,13,8,14},{1,14,3,15},{6,14,8,15},{2,15,7,16},{1,5,6,6},{1,6,2,11},{6,6,7,7},{7,7,8,10},{6,10,7,11},
+{1,11,6,12},{1,12,2,16},{2,5,6,6},{1,6,2,8},{6,6,7,7},{6,7,8,8},{0,8,1,13},{7,8,8,13},{0,13,2,14},{6,13,7,15},
+{1,14,2,15},{2,15,6,16},{3,16,4,17},{3,17,5,18},{7,17,8,18},{4,18,7,19},{1,5,6,6},{1,6,2,10},{5,6,7,7},{6,7,7,9},
+{5,9,7,10},{1,10,5,11},{1,11,2,16},{4,11,6,12},{5,12,6,13},{5,13,7,14},{6,14,7,15},{6,15,8,16},{2,5,6,6},{1,6,3,7},
+{6,6,7,7},{1,7,2,9},{2,9,4,10},{3,10,6,11},{6,11,8,12},{7,12,8,14},{1,14,2,15},{6,14,8,15},{2,15,6,16},{1,5,8,6},
+{4,6,5,16},{1,5,2,14},{7,5,8,14},{1,14,3,15},{6,14,7,15},{2,15,6,16},{0,5,1,6},{8,5,9,6},{0,6,2,8},{7,6,9,8},
+{1,8,2,9},{7,8,8,9},{1,9,3,11},{6,9,8,10},{6,10,7,12},{2,11,3,12},{2,12,4,13},{5,12,7,13},{3,13,4,15},{5,13,6,15},
+{3,15,6,16},{1,5,2,14},{7,5,8,14},{4,9,5,11},{3,11,4,14},{5,11,6,14},{1,14,3,16},{6,14,8,16},{0,5,2,6},{7,5,9,6},
+{1,6,3,7},{6,6,8,7},{2,7,3,8},{6,7,7,8},{2,8,4,9},{5,8,7,9},{3,9,6,10},{4,10,5,11},{3,11,6,12},{2,12,4,13},
+{5,12,7,13},{2,13,3,14},{6,13,7,14},{1,14,3,15},{6,14,8,15},{0,15,2,16},{7,15,9,16},{0,5,1,6},{8,5,9,6},{1,6,2,7},
+{7,6,8,7},{1,7,3,8},{6,7,8,8},{2,8,3,9},{6,8,7,9},{3,9,4,11},{5,9,6,11},{4,11,5,16},{1,5,8,6},{6,6,7,7},
+{5,7,7,8},{5,8,6,9},{4,9,6,10},{4,10,5,11},{3,11,5,12},{3,12,4,13},{2,13,4,14},{2,14,3,15},{1,15,8,16},{3,4,7,5},
+{3,5,4,18},{3,18,7,19},{1,4,3,5},{2,5,3,7},{2,7,4,8},{3,8,4,9},{3,9,5,10},{4,10,5,11},{4,11,6,12},{5,12,6,14},
+{5,14,7,15},{6,15,7,16},{6,16,8,17},{7,17,8,18},{2,4,6,5},{5,5,6,18},{2,18,6,19},{4,5,6,6},{3,6,4,7},{5,6,6,7},
+{2,7,3,9},{6,7,7,8},{6,8,8,9},{1,9,2,10},{7,9,8,10},{0,18,9,19},{2,4,4,5},{3,5,5,6},{3,8,6,9},{2,9,3,10},
+{6,9,7,11},{2,11,7,12},{1,12,2,15},{6,12,7,14},{5,14,7,15},{2,15,5,16},{6,15,7,16},{1,4,2,9},{3,8,7,9},{1,9,3,10},
+{6,9,8,10},{1,10,2,15},{7,10,8,14},{6,14,7,15},{1,15,6,16},{3,8,6,9},{2,9,3,10},{6,9,7,10},{1,10,2,14},{2,14,3,15},
+{6,14,7,15},{3,15,6,16},{7,4,8,8},{3,8,8,9},{2,9,3,10},{7,9,8,14},{1,10,2,14},{2,14,3,15},{5,14,8,15},{2,15,6,16},
+{7,15,8,16},{3,8,7,9},{2,9,3,10},{6,9,8,10},{1,10,2,11},{7,10,8,11},{1,11,8,12},{1,12,2,14},{2,14,3,15},{3,15,8,16},
+{4,4,8,5},{3,5,5,6},{3,6,4,9},{1,9,7,10},{3,10,4,16},{2,8,8,9},{1,9,2,12},{6,9,7,12},{1,12,6,13},{1,13,2,15},
+{2,15,7,16},{1,16,2,18},{7,16,8,18},{2,18,7,19},{1,4,2,9},{3,8,6,9},{1,9,3,10},{6,9,7,16},{1,10,2,16},{3,4,5,6},
+{1,8,5,9},{4,9,5,15},{1,15,8,16},{5,4,7,6},{1,8,7,9},{6,9,7,17},{1,17,2,18},{5,17,7,18},{2,18,5,19},{2,4,3,11},
+{6,8,8,9},{5,9,7,10},{4,10,5,11},{2,11,4,12},{2,12,3,16},{4,12,5,13},{5,13,6,14},{6,14,7,15},{7,15,8,16},{1,4,5,5},
+{4,5,5,15},{1,15,8,16},{1,8,8,9},{1,9,3,10},{4,9,6,10},{7,9,8,16},{1,10,2,16},{4,10,5,16},{1,8,2,9},{3,8,6,9},
+{1,9,3,10},{6,9,7,16},{1,10,2,16},{3,8,6,9},{2,9,3,10},{6,9,7,10},{1,10,2,14},{7,10,8,14},{2,14,3,15},{6,14,7,15},
+{3,15,6,16},{1,8,2,9},{3,8,7,9},{1,9,3,10},{6,9,8,10},{1,10,2,15},{7,10,8,14},{6,14,7,15},{1,15,6,16},{1,16,2,19},
+{3,8,8,9},{2,9,3,10},{7,9,8,14},{1,10,2,14},{1,14,3,15},{5,14,8,15},{2,15,6,16},{7,15,8,19},{2,8,3,9},{4,8,7,9},
+{2,9,4,10},{7,9,8,11},{2,10,3,16},{3,8,7,9},{2,9,3,11},{3,11,5,12},{5,12,8,13},{7,13,8,15},{2,15,7,16},{3,5,4,8},
+{1,8,9,9},{3,9,4,13},{3,13,5,14},{4,14,5,15},{5,15,9,16},{1,8,2,15},{6,8,7,14},{5,14,7,15},{2,15,5,16},{6,15,7,16},
+{1,8,2,9},{7,8,8,9},{1,9,3,11},{6,9,8,10},{6,10,7,12},{2,11,3,12},{2,12,4,13},{5,12,7,13},{3,13,4,15},{5,13,6,15},
+{3,15,5,16},{1,8,2,15},{7,8,8,15},{4,10,5,12},{3,12,4,15},{5,12,6,15},{1,15,3,16},{6,15,8,16},{1,8,3,9},{7,8,9,9},
+{2,9,4,10},{6,9,8,10},{3,10,4,11},{5,10,7,11},{3,11,6,12},{4,12,6,13},{3,13,4,14},{5,13,6,14},{2,14,4,15},{5,14,7,15},
+{1,15,3,16},{6,15,8,16},{1,8,2,9},{7,8,8,9},{1,9,3,11},{6,9,8,10},{6,10,7,12},{2,11,3,12},{2,12,4,13},{5,12,6,15},
+{3,13,4,15},{3,15,5,17},{3,17,4,18},{0,18,3,19},{1,8,7,9},{5,9,6,10},{4,10,6,11},{4,11,5,12},{3,12,4,13},{2,13,4,14},
+{2,14,3,15},{1,15,7,16},{5,4,8,5},{4,5,6,6},{4,6,5,11},{2,11,4,12},{4,12,5,17},{4,17,6,18},{5,18,8,19},{4,2,5,19},
+{2,4,5,5},{4,5,6,6},{5,6,6,11},{6,11,8,12},{5,12,6,17},{4,17,6,18},{2,18,5,19},{2,10,5,11},{8,10,9,12},{1,11,2,13},
+{4,11,6,12},{5,12,8,13},
+};
+const Font font = { 10, 20, 32, 126, glyphs, spans };
+}
+
+namespace spans24 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{4,5,7,19,0,2},
+{3,5,9,10,2,2},
+{0,6,11,19,4,10},
+{1,4,10,21,14,17},
+{0,5,12,19,31,26},
+{1,5,12,19,57,16},
+{5,5,7,10,73,1},
+{3,4,9,23,74,11},
+{3,4,9,23,85,11},
+{2,5,9,14,96,9},
+{1,8,11,18,105,3},
+{2,16,7,23,108,6},
+{3,12,9,14,114,1},
+{4,16,7,19,115,1},
+{1,5,9,21,116,12},
+{1,6,11,19,128,17},
+{2,6,10,19,145,6},
+{2,6,11,19,151,11},
+{2,6,11,19,162,12},
+{0,6,11,19,174,11},
+{2,6,10,19,185,9},
+{1,6,10,19,194,15},
+{1,6,10,19,209,7},
+{1,6,10,19,216,13},
+{1,6,10,19,229,15},
+{4,9,7,19,244,2},
+{2,9,7,23,246,7},
+{2,7,9,19,253,11},
+{1,10,10,16,264,2},
+{2,7,9,19,266,11},
+{3,5,9,19,277,8},
+{0,5,11,23,285,22},
+{0,6,11,19,307,14},
+{2,6,11,19,321,13},
+{1,6,11,19,334,11},
+{1,6,11,19,345,10},
+{2,6,10,19,355,5},
+{2,6,10,19,360,4},
+{1,6,11,19,364,12},
+{1,6,10,19,376,5},
+{2,6,10,19,381,3},
+{2,6,9,19,384,6},
+{2,6,10,19,390,13},
+{2,6,10,19,403,2},
+{1,6,12,19,405,15},
+{1,6,10,19,420,11},
+{1,6,11,19,431,14},
+{2,6,11,19,445,9},
+{1,6,12,23,454,19},
+{2,6,11,19,473,13},
+{1,6,10,19,486,13},
+{1,6,11,19,499,2},
+{1,6,11,19,501,6},
+{1,6,12,19,507,11},
+{1,6,11,19,518,11},
+{0,6,12,19,529,20},
+{0,6,12,19,549,11},
+{1,6,11,19,560,11},
+{3,4,8,23,571,3},
+{2,5,10,21,574,12},
+{3,4,8,23,586,3},
+{2,6,10,13,589,10},
+{0,21,12,23,599,1},
+{2,4,7,7,600,3},
+{1,9,10,19,603,12},
+{2,5,11,19,615,10},
+{2,9,10,19,625,9},
+{1,5,10,19,634,11},
+{1,9,10,19,645,11},
+{1,5,11,19,656,6},
+{1,9,11,23,662,13},
+{2,5,10,19,675,6},
+{2,4,10,19,681,4},
+{2,4,9,23,685,6},
+{2,5,11,19,691,12},
+{2,5,10,19,703,3},
+{1,9,11,19,706,9},
+{2,9,10,19,715,6},
+{1,9,11,19,721,10},
+{2,9,11,23,731,11},
+{1,9,10,23,742,10},
+{2,9,11,19,752,6},
+{2,9,10,19,758,10},
+{1,6,10,19,768,5},
+{2,9,10,19,773,6},
+{2,9,11,19,779,12},
+{1,9,10,19,791,13},
+{1,9,11,19,804,15},
+{1,9,11,23,819,15},
+{2,9,10,19,834,8},
+{2,4,10,23,842,10},
+{5,2,7,23,852,1},
+{2,4,10,23,853,10},
+{1,11,12,16,863,7},
+};
+const GlyphSpan spans[] = {
+{4,5,6,15},{4,16,7,19},{3,5,5,10},{7,5,9,10},{3,6,4,9},{7,6,9,9},{1,9,11,11},{3,11,4,12},{7,11,9,12},{2,12,4,13},
+{6,12,8,13},{0,13,10,15},{2,15,4,19},{6,15,8,19},{6,4,7,6},{3,6,9,7},{2,7,9,8},{1,8,3,10},{5,8,7,10},{1,10,4,11},
+{5,10,6,11},{2,11,6,12},{3,12,8,13},{4,13,9,14},{4,14,6,17},{8,14,10,16},{1,16,2,17},{7,16,10,17},{1,17,9,18},{2,18,8,19},
+{4,19,5,21},{1,5,5,6},{10,5,11,6},{0,6,6,7},{9,6,11,7},{0,7,2,9},{4,7,6,9},{8,7,10,8},{7,8,9,9},{0,9,6,10},
+{7,9,8,10},{1,10,5,11},{6,10,8,11},{5,11,7,12},{5,12,6,13},{4,13,6,14},{7,13,11,14},{3,14,5,15},{6,14,12,15},{2,15,4,16},
+{6,15,8,17},{10,15,12,17},{2,16,3,17},{1,17,3,18},{6,17,12,18},{0,18,2,19},{7,18,11,19},{4,5,8,6},{2,6,9,7},{2,7,4,10},
+{7,7,9,10},{3,10,8,11},{3,11,6,12},{2,12,7,13},{9,12,11,14},{1,13,3,16},{5,13,7,14},{6,14,11,15},{7,15,10,17},{1,16,4,17},
+{2,17,11,18},{3,18,7,19},{9,18,12,19},{5,5,7,10},{7,4,8,5},{6,5,9,6},{6,6,8,7},{5,7,7,8},{4,8,6,10},{3,10,5,17},
+{4,17,6,19},{5,19,7,20},{5,20,8,21},{6,21,9,22},{7,22,8,23},{4,4,5,5},{3,5,6,6},{4,6,6,7},{5,7,7,8},{6,8,8,10},
+{7,10,9,17},{6,17,8,19},{5,19,7,20},{4,20,6,21},{3,21,6,22},{4,22,5,23},{5,5,6,8},{2,7,3,8},{8,7,9,8},{3,8,8,9},
+{5,9,6,10},{3,10,8,11},{2,11,3,12},{5,11,6,14},{8,11,9,12},{5,8,7,12},{1,12,11,14},{5,14,7,18},{4,16,6,17},{4,17,7,18},
+{5,18,7,20},{4,20,7,21},{2,21,6,22},{2,22,4,23},{3,12,9,14},{4,16,7,19},{8,5,9,6},{7,6,9,8},{6,8,8,10},{6,10,7,11},
+{5,11,7,12},{5,12,6,13},{4,13,6,15},{3,15,5,17},{3,17,4,18},{2,18,4,19},{2,19,3,20},{1,20,3,21},{4,6,8,7},{3,7,10,8},
+{2,8,4,9},{8,8,10,9},{1,9,4,10},{8,9,11,11},{1,10,3,13},{6,11,11,12},{4,12,8,13},{9,12,11,15},{1,13,6,14},{1,14,4,16},
+{8,15,11,16},{2,16,4,17},{8,16,10,17},{2,17,9,18},{4,18,8,19},{5,6,7,7},{3,7,7,8},{2,8,4,9},{5,8,7,17},{2,9,3,10},
+{2,17,10,19},{4,6,8,7},{2,7,9,8},{3,8,4,9},{7,8,10,9},{8,9,10,12},{7,12,9,13},{6,13,8,14},{5,14,7,15},{4,15,6,16},
+{3,16,5,17},{2,17,11,19},{3,6,8,7},{2,7,10,8},{2,8,3,9},{8,8,10,10},{7,10,10,11},{4,11,8,12},{4,12,10,13},{8,13,11,14},
+{9,14,11,16},{8,16,11,17},{2,17,10,18},{2,18,8,19},{6,6,9,7},{5,7,9,8},{4,8,6,9},{7,8,9,14},{4,9,5,10},{3,10,5,11},
+{2,11,4,12},{1,12,3,13},{0,13,2,14},{0,14,11,16},{7,16,9,19},{2,6,9,8},{2,8,4,11},{2,11,8,12},{2,12,9,13},{7,13,10,14},
+{8,14,10,16},{7,16,10,17},{2,17,9,18},{2,18,7,19},{5,6,9,7},{3,7,9,8},{2,8,5,9},{2,9,4,10},{1,10,3,12},{4,11,8,12},
+{1,12,9,13},{1,13,4,14},{7,13,10,14},{1,14,3,16},{8,14,10,16},{2,16,4,17},{7,16,10,17},{2,17,9,18},{3,18,8,19},{1,6,10,8},
+{8,8,10,9},{7,9,9,11},{6,11,8,13},{5,13,7,15},{4,15,6,17},{3,17,5,19},{3,6,8,7},{2,7,10,8},{1,8,3,10},{8,8,10,10},
+{1,10,4,11},{7,10,9,11},{3,11,8,13},{2,13,4,14},{6,13,9,14},{1,14,3,17},{8,14,10,17},{2,17,9,18},{3,18,8,19},{3,6,8,7},
+{2,7,9,8},{1,8,4,9},{7,8,9,9},{1,9,3,11},{8,9,10,11},{1,11,4,12},{7,11,10,12},{2,12,10,13},{3,13,7,14},{8,13,10,15},
+{7,15,9,16},{6,16,9,17},{2,17,8,18},{2,18,6,19},{4,9,7,12},{4,16,7,19},{4,9,7,12},{4,16,6,17},{4,17,7,18},{5,18,7,20},
+{4,20,7,21},{2,21,6,22},{2,22,4,23},{7,7,8,8},{6,8,9,9},{5,9,7,10},{4,10,6,11},{3,11,5,12},{2,12,4,14},{3,14,5,15},
+{4,15,6,16},{5,16,7,17},{6,17,9,18},{7,18,8,19},{1,10,10,12},{1,14,10,16},{3,7,4,8},{2,8,5,9},{4,9,6,10},{5,10,7,11},
+{6,11,8,12},{7,12,9,14},{6,14,8,15},{5,15,7,16},{4,16,6,17},{2,17,5,18},{3,18,4,19},{3,5,6,6},{3,6,8,7},{6,7,8,8},
+{7,8,9,11},{4,11,9,12},{4,12,8,13},{4,13,6,15},{4,16,7,19},{4,5,9,6},{3,6,5,7},{8,6,10,7},{2,7,3,9},{9,7,10,8},
+{10,8,11,16},{1,9,2,11},{4,10,9,11},{0,11,2,12},{3,11,9,12},{0,12,1,19},{3,12,5,13},{7,12,9,16},{2,13,4,16},{2,16,10,17},
+{3,17,7,18},{8,17,10,18},{0,19,2,20},{1,20,2,21},{1,21,3,22},{7,21,8,22},{2,22,8,23},{4,6,7,7},{4,7,5,8},{6,7,7,8},
+{3,8,5,10},{6,8,8,10},{3,10,4,11},{7,10,8,11},{2,11,4,13},{7,11,9,13},{2,13,3,14},{8,13,10,14},{1,14,10,16},{0,16,2,19},
+{9,16,11,19},{2,6,9,7},{2,7,11,8},{2,8,4,11},{9,8,11,10},{8,10,11,11},{2,11,9,12},{2,12,10,13},{2,13,4,17},{8,13,11,14},
+{9,14,11,16},{8,16,11,17},{2,17,10,18},{2,18,8,19},{5,6,10,7},{3,7,11,8},{2,8,5,9},{10,8,11,9},{2,9,4,10},{1,10,3,15},
+{1,15,4,16},{2,16,5,17},{10,16,11,17},{3,17,11,18},{4,18,10,19},{1,6,8,7},{1,7,9,8},{1,8,3,17},{7,8,10,9},{8,9,11,10},
+{9,10,11,15},{8,15,10,16},{7,16,10,17},{1,17,9,18},{1,18,7,19},{2,6,10,8},{2,8,4,11},{2,11,10,13},{2,13,4,17},{2,17,10,19},
+{2,6,10,8},{2,8,4,11},{2,11,10,13},{2,13,4,19},{5,6,10,7},{3,7,11,8},{2,8,5,9},{10,8,11,9},{2,9,4,10},{1,10,3,15},
+{6,11,11,13},{9,13,11,17},{1,15,4,16},{2,16,5,17},{3,17,11,18},{4,18,10,19},{1,6,3,11},{8,6,10,11},{1,11,10,13},{1,13,3,19},
+{8,13,10,19},{2,6,10,8},{5,8,7,17},{2,17,10,19},{2,6,9,8},{7,8,9,16},{2,16,3,17},{6,16,9,17},{2,17,8,18},{3,18,7,19},
+{2,6,4,12},{8,6,10,7},{7,7,9,8},{6,8,8,10},{5,10,7,11},{5,11,6,12},{2,12,6,13},{2,13,4,19},{5,13,7,15},{6,15,8,16},
+{6,16,9,17},{7,17,9,18},{8,18,10,19},{2,6,4,17},{2,17,10,19},{2,6,4,7},{9,6,11,7},{2,7,5,8},{8,7,11,8},{2,8,3,16},
+{4,8,5,11},{8,8,9,9},{10,8,11,14},{7,9,9,10},{7,10,8,12},{4,11,6,12},{5,12,8,13},{5,13,7,15},{10,14,12,19},{1,16,3,19},
+{1,6,4,8},{8,6,10,16},{1,8,5,9},{1,9,3,19},{4,9,5,11},{4,11,6,12},{5,12,6,13},{5,13,7,14},{6,14,7,16},{6,16,10,17},
+{7,17,10,19},{4,6,8,7},{3,7,10,8},{2,8,4,9},{8,8,10,9},{1,9,4,10},{8,9,11,10},{1,10,3,15},{9,10,11,15},{1,15,4,16},
+{8,15,11,16},{2,16,4,17},{8,16,10,17},{2,17,9,18},{4,18,8,19},{2,6,9,7},{2,7,10,8},{2,8,4,12},{8,8,11,9},{9,9,11,11},
+{8,11,11,12},{2,12,10,13},{2,13,8,14},{2,14,4,19},{4,6,9,7},{3,7,10,8},{2,8,5,9},{8,8,11,9},{2,9,4,10},{9,9,12,10},
+{1,10,3,15},{10,10,12,15},{1,15,4,16},{9,15,12,16},{2,16,5,17},{8,16,11,17},{2,17,10,18},{4,18,9,19},{5,19,7,20},{5,20,8,21},
+{11,20,12,21},{6,21,12,22},{7,22,11,23},{2,6,8,7},{2,7,9,8},{2,8,4,12},{7,8,10,9},{8,9,10,11},{7,11,10,12},{2,12,9,13},
+{2,13,7,14},{2,14,4,19},{6,14,9,15},{7,15,9,16},{8,16,10,18},{9,18,11,19},{3,6,8,7},{2,7,9,8},{1,8,3,10},{8,8,9,9},
+{1,10,4,11},{2,11,6,12},{3,12,8,13},{6,13,9,14},{8,14,10,16},{1,16,2,17},{7,16,10,17},{1,17,9,18},{2,18,8,19},{1,6,11,8},
+{5,8,7,19},{1,6,3,16},{9,6,11,16},{1,16,4,17},{8,16,11,17},{2,17,10,18},{3,18,9,19},{1,6,3,9},{10,6,12,9},{2,9,4,12},
+{9,9,11,11},{9,11,10,12},{3,12,5,14},{8,12,10,14},{4,14,6,17},{8,14,9,15},{7,15,9,17},{5,17,8,19},{1,6,3,13},{9,6,11,13},
+{5,10,7,13},{2,13,3,17},{4,13,8,14},{9,13,10,16},{4,14,5,17},{7,14,8,16},{7,16,10,17},{2,17,4,19},{8,17,10,19},{1,6,4,7},
+{9,6,11,7},{2,7,4,8},{8,7,10,8},{3,8,5,9},{7,8,9,9},{3,9,9,10},{4,10,8,11},{5,11,7,12},{4,12,8,14},{3,14,5,15},
+{7,14,9,15},{2,15,5,16},{7,15,10,16},{2,16,4,17},{8,16,10,17},{1,17,3,18},{9,17,11,18},{0,18,3,19},{9,18,12,19},{0,6,2,7},
+{10,6,12,7},{1,7,3,8},{9,7,11,8},{2,8,4,10},{8,8,10,10},{3,10,5,11},{7,10,9,12},{3,11,6,12},{4,12,8,13},{5,13,7,19},
+{1,6,10,8},{7,8,9,9},{7,9,8,10},{6,10,8,11},{5,11,7,12},{5,12,6,13},{4,13,6,14},{3,14,5,15},{3,15,4,16},{2,16,4,17},
+{1,17,11,19},{3,4,8,6},{3,6,5,21},{3,21,8,23},{2,5,4,6},{3,6,4,7},{3,7,5,8},{4,8,5,9},{4,9,6,11},{5,11,7,13},
+{6,13,7,14},{6,14,8,15},{7,15,8,16},{7,16,9,18},{8,18,10,20},{9,20,10,21},{3,4,8,6},{6,6,8,21},{3,21,8,23},{5,6,7,7},
+{4,7,7,8},{4,8,5,9},{6,8,8,9},{3,9,5,10},{7,9,8,10},{3,10,4,11},{7,10,9,11},{2,11,4,13},{8,11,10,13},{0,21,12,23},
+{2,4,5,5},{3,5,6,6},{4,6,7,7},{3,9,8,10},{2,10,10,11},{2,11,3,12},{8,11,10,13},{3,13,10,14},{2,14,10,15},{1,15,3,17},
+{8,15,10,16},{7,16,10,17},{1,17,10,18},{2,18,7,19},{8,18,10,19},{2,5,4,10},{5,9,9,10},{2,10,10,11},{2,11,5,12},{8,11,11,12},
+{2,12,4,17},{9,12,11,16},{8,16,10,17},{2,17,10,18},{3,18,8,19},{5,9,9,10},{3,10,10,11},{3,11,5,12},{9,11,10,12},{2,12,4,16},
+{2,16,5,17},{9,16,10,17},{3,17,10,18},{4,18,9,19},{8,5,10,9},{4,9,10,10},{2,10,10,11},{2,11,4,12},{8,11,10,16},{1,12,3,16},
+{1,16,4,17},{6,16,10,17},{2,17,10,18},{3,18,7,19},{8,18,10,19},{3,9,8,10},{2,10,9,11},{2,11,4,12},{7,11,10,12},{1,12,3,13},
+{8,12,10,13},{1,13,10,15},{1,15,3,16},{1,16,4,17},{2,17,9,18},{3,18,9,19},{6,5,11,6},{5,6,11,7},{4,7,7,8},{4,8,6,10},
+{1,10,10,12},{4,12,6,19},{4,9,11,10},{3,10,11,11},{2,11,4,14},{8,11,10,14},{3,14,9,15},{2,15,8,16},{1,16,3,17},{1,17,10,18},
+{3,18,11,19},{1,19,3,21},{9,19,11,21},{1,21,10,22},{2,22,9,23},{2,5,4,10},{5,9,9,10},{2,10,10,11},{2,11,5,12},{8,11,10,19},
+{2,12,4,19},{4,4,7,7},{2,9,7,11},{5,11,7,17},{2,17,10,19},{6,4,9,7},{2,9,9,11},{7,11,9,21},{2,20,3,21},{2,21,8,22},
+{3,22,7,23},{2,5,4,13},{8,9,10,10},{7,10,9,11},{6,11,8,12},{5,12,7,13},{2,13,6,14},{2,14,4,19},{5,14,7,15},{6,15,8,16},
+{7,16,9,17},{8,17,10,18},{9,18,11,19},{2,5,7,7},{5,7,7,17},{2,17,10,19},{1,9,3,10},{4,9,6,10},{8,9,10,10},{1,10,11,11},
+{1,11,4,12},{5,11,8,12},{9,11,11,19},{1,12,3,19},{5,12,7,19},{2,9,4,10},{5,9,9,10},{2,10,10,11},{2,11,5,12},{8,11,10,19},
+{2,12,4,19},{4,9,9,10},{2,10,10,11},{2,11,4,12},{8,11,11,12},{1,12,3,16},{9,12,11,16},{1,16,4,17},{8,16,10,17},{2,17,10,18},
+{3,18,8,19},{2,9,4,10},{5,9,9,10},{2,10,10,11},{2,11,5,12},{8,11,11,12},{2,12,4,17},{9,12,11,16},{8,16,10,17},{2,17,10,18},
+{2,18,8,19},{2,19,4,23},{4,9,10,10},{2,10,10,11},{2,11,4,12},{8,11,10,16},{1,12,3,16},{1,16,4,17},{6,16,10,17},{2,17,10,18},
+{3,18,7,19},{8,18,10,23},{2,9,4,10},{6,9,10,10},{2,10,11,11},{2,11,6,12},{9,11,11,13},{2,12,4,19},{4,9,8,10},{2,10,9,11},
+{2,11,4,13},{8,11,9,12},{3,13,7,14},{5,14,9,15},{8,15,10,17},{2,16,3,17},{2,17,10,18},{3,18,8,19},{4,6,6,9},{1,9,10,11},
+{4,11,6,17},{4,17,10,18},{5,18,10,19},{2,9,4,17},{8,9,10,16},{7,16,10,17},{2,17,10,18},{3,18,7,19},{8,18,10,19},{2,9,4,12},
+{9,9,11,11},{9,11,10,12},{3,12,5,14},{8,12,10,14},{4,14,5,15},{8,14,9,15},{4,15,6,17},{7,15,9,16},{7,16,8,18},{5,17,6,18},
+{5,18,8,19},{1,9,2,11},{9,9,10,17},{1,11,3,15},{5,11,6,12},{5,12,7,13},{4,13,5,17},{6,13,7,15},{2,15,3,17},{6,15,8,16},
+{7,16,8,17},{2,17,5,18},{7,17,10,19},{2,18,4,19},{1,9,4,10},{8,9,11,10},{2,10,4,11},{8,10,10,11},{3,11,5,12},{7,11,9,12},
+{4,12,8,14},{5,14,8,15},{4,15,8,16},{3,16,5,17},{7,16,9,17},{2,17,4,18},{8,17,10,18},{1,18,4,19},{8,18,11,19},{2,9,4,12},
+{9,9,11,11},{9,11,10,12},{3,12,5,14},{8,12,10,14},{4,14,5,15},{8,14,9,15},{4,15,6,17},{7,15,9,16},{7,16,8,17},{5,17,8,18},
+{5,18,7,20},{4,20,7,21},{1,21,6,22},{1,22,5,23},{2,9,10,11},{7,11,9,12},{7,12,8,13},{6,13,7,14},{5,14,6,15},{4,15,6,16},
+{3,16,5,17},{2,17,10,19},{7,4,10,5},{6,5,10,6},{5,6,8,7},{5,7,7,12},{2,12,6,14},{4,14,7,15},{5,15,7,20},{5,20,8,21},
+{6,21,10,22},{7,22,10,23},{5,2,7,23},{2,4,5,5},{2,5,6,6},{4,6,7,7},{5,7,7,11},{5,11,8,12},{6,12,10,14},{5,14,7,20},
+{4,20,7,21},{2,21,7,22},{2,22,5,23},{2,11,6,12},{2,12,7,13},{10,12,12,14},{1,13,3,15},{5,13,8,14},{6,14,11,15},{7,15,11,16},
+};
+const Font font = { 12, 24, 32, 126, glyphs, spans };
+}
+
+namespace spans28 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{5,5,8,22,0,2},
+{3,5,11,11,2,2},
+{1,7,13,22,4,8},
+{1,4,11,25,12,21},
+{0,5,13,22,33,25},
+{1,5,13,22,58,24},
+{5,5,8,11,82,1},
+{4,5,11,27,83,14},
+{3,5,10,27,97,14},
+{2,5,12,15,111,11},
+{1,9,13,21,122,3},
+{3,18,9,26,125,6},
+{3,15,10,17,131,1},
+{5,18,9,22,132,3},
+{1,5,11,25,135,9},
+{1,7,12,22,144,21},
+{2,7,12,22,165,6},
+{2,7,12,22,171,14},
+{2,7,11,22,185,13},
+{1,7,13,22,198,10},
+{2,7,11,22,208,9},
+{1,7,11,22,217,16},
+{1,7,11,22,233,9},
+{1,7,11,22,242,19},
+{1,7,11,22,261,15},
+{5,10,8,22,276,6},
+{3,10,9,26,282,9},
+{2,9,11,22,291,13},
+{2,12,12,18,304,2},
+{2,9,11,22,306,13},
+{4,5,11,22,319,9},
+{0,5,13,27,328,24},
+{1,7,13,22,352,13},
+{2,7,12,22,365,14},
+{1,7,11,22,379,13},
+{1,7,12,22,392,11},
+{2,7,11,22,403,5},
+{2,7,11,22,408,4},
+{1,7,12,22,412,13},
+{1,7,12,22,425,5},
+{2,7,12,22,430,3},
+{2,7,10,22,433,6},
+{2,7,12,22,439,17},
+{3,7,12,22,456,2},
+{1,7,13,22,458,15},
+{1,7,12,22,473,12},
+{1,7,13,22,485,14},
+{2,7,12,22,499,9},
+{1,7,14,26,508,19},
+{2,7,12,22,527,15},
+{1,7,11,22,542,15},
+{1,7,13,22,557,2},
+{1,7,12,22,559,6},
+{0,7,13,22,565,17},
+{1,7,12,22,582,13},
+{0,7,13,22,595,25},
+{0,7,13,22,620,16},
+{1,7,12,22,636,11},
+{4,5,10,27,647,3},
+{2,5,12,25,650,9},
+{3,5,9,27,659,3},
+{2,7,11,14,662,9},
+{0,25,13,27,671,1},
+{3,5,8,8,672,3},
+{2,10,12,22,675,14},
+{2,5,12,22,689,12},
+{2,10,11,22,701,11},
+{1,5,11,22,712,13},
+{1,10,11,22,725,12},
+{1,5,12,22,737,6},
+{1,10,12,27,743,19},
+{2,5,11,22,762,8},
+{2,5,11,22,770,4},
+{2,5,10,27,774,7},
+{2,5,12,22,781,14},
+{2,5,11,22,795,3},
+{1,10,13,22,798,9},
+{2,10,11,22,807,8},
+{1,10,12,22,815,14},
+{2,10,12,27,829,13},
+{1,10,11,27,842,12},
+{2,10,12,22,854,8},
+{2,10,11,22,862,12},
+{1,6,12,22,874,8},
+{2,10,11,22,882,8},
+{1,10,12,22,890,13},
+{1,10,12,22,903,14},
+{1,10,12,22,917,20},
+{0,10,12,27,937,17},
+{2,10,11,22,954,8},
+{2,5,10,27,962,11},
+{6,3,8,27,973,1},
+{3,5,11,27,974,11},
+{1,13,13,18,985,7},
+};
+const GlyphSpan spans[] = {
+{5,5,7,17},{5,19,8,22},{3,5,6,11},{8,5,11,11},{5,7,7,11},{9,7,11,11},{2,11,13,13},{4,13,6,16},{8,13,10,16},{1,16,12,18},
+{3,18,5,22},{7,18,9,22},{6,4,8,6},{4,6,10,7},{2,7,10,8},{1,8,4,9},{6,8,7,11},{1,9,3,11},{1,11,4,12},{5,11,7,12},
+{2,12,7,13},{3,13,8,14},{5,14,9,15},{5,15,10,16},{5,16,7,17},{9,16,11,19},{5,17,6,19},{1,19,2,20},{4,19,6,20},{8,19,11,20},
+{1,20,10,21},{2,21,8,22},{4,22,6,25},{2,5,6,6},{11,5,13,6},{1,6,7,7},{10,6,12,7},{0,7,2,10},{5,7,7,10},{9,7,11,9},
+{8,9,10,10},{0,10,6,11},{7,10,9,12},{1,11,5,12},{6,12,8,13},{5,13,7,15},{4,15,6,16},{8,15,12,16},{4,16,5,17},{7,16,13,17},
+{3,17,5,18},{6,17,8,20},{11,17,13,20},{2,18,4,20},{1,20,3,21},{6,20,12,21},{0,21,2,22},{7,21,11,22},{4,5,8,6},{3,6,9,7},
+{2,7,5,8},{7,7,10,8},{2,8,4,11},{8,8,10,10},{7,10,10,11},{3,11,5,12},{6,11,9,12},{3,12,8,13},{3,13,6,14},{2,14,7,15},
+{10,14,12,17},{1,15,4,16},{5,15,8,16},{1,16,3,19},{6,16,9,17},{7,17,11,18},{8,18,11,19},{1,19,4,20},{7,19,11,20},{2,20,12,21},
+{3,21,8,22},{10,21,13,22},{5,5,8,11},{9,5,10,6},{8,6,11,7},{7,7,10,8},{7,8,9,9},{6,9,8,10},{5,10,7,13},{4,13,6,19},
+{4,19,7,20},{5,20,7,22},{6,22,8,23},{6,23,9,24},{7,24,10,25},{8,25,11,26},{9,26,10,27},{4,5,5,6},{3,6,6,7},{4,7,7,8},
+{5,8,8,9},{6,9,8,10},{7,10,9,12},{7,12,10,13},{8,13,10,19},{7,19,9,22},{6,22,8,23},{5,23,7,24},{4,24,7,25},{3,25,6,26},
+{4,26,5,27},{6,5,8,9},{3,7,4,8},{10,7,11,8},{2,8,5,9},{9,8,12,9},{5,9,9,11},{2,11,5,12},{6,11,8,15},{9,11,12,12},
+{2,12,4,13},{10,12,11,13},{6,9,8,14},{1,14,13,16},{6,16,8,21},{5,18,8,19},{5,19,9,21},{6,21,9,23},{5,23,8,24},{3,24,7,25},
+{3,25,6,26},{3,15,10,17},{6,18,8,19},{5,19,9,21},{6,21,8,22},{9,5,11,6},{8,6,10,9},{7,9,9,11},{6,11,8,14},{5,14,7,16},
+{4,16,6,19},{3,19,5,21},{2,21,4,24},{1,24,3,25},{4,7,9,8},{3,8,10,9},{2,9,5,10},{8,9,11,10},{2,10,4,11},{9,10,11,11},
+{1,11,3,16},{9,11,12,12},{8,12,12,13},{6,13,9,14},{10,13,12,18},{5,14,8,15},{4,15,7,16},{1,16,5,17},{1,17,4,18},{2,18,4,19},
+{9,18,11,19},{2,19,5,20},{8,19,11,20},{3,20,10,21},{4,21,9,22},{5,7,8,8},{3,8,8,9},{2,9,5,10},{6,9,8,20},{3,10,4,11},
+{2,20,12,22},{4,7,9,8},{3,8,10,9},{2,9,5,10},{8,9,11,10},{3,10,4,11},{9,10,11,13},{8,13,11,14},{8,14,10,15},{7,15,9,16},
+{6,16,8,17},{5,17,7,18},{4,18,6,19},{3,19,5,20},{2,20,12,22},{3,7,8,8},{2,8,9,9},{2,9,3,10},{7,9,10,10},{8,10,10,12},
+{7,12,9,13},{4,13,8,14},{4,14,10,15},{8,15,11,16},{9,16,11,19},{8,19,10,20},{2,20,10,21},{2,21,8,22},{7,7,10,8},{6,8,10,10},
+{5,10,7,11},{8,10,10,17},{4,11,6,13},{3,13,5,15},{2,15,4,16},{1,16,3,17},{1,17,13,19},{8,19,10,22},{2,7,10,9},{2,9,4,13},
+{2,13,9,14},{2,14,10,15},{8,15,11,16},{9,16,11,19},{8,19,10,20},{2,20,9,21},{2,21,8,22},{5,7,10,8},{4,8,10,9},{3,9,6,10},
+{2,10,4,11},{2,11,3,12},{1,12,3,14},{4,13,9,14},{1,14,10,15},{1,15,4,16},{8,15,11,16},{1,16,3,19},{9,16,11,19},{2,19,4,20},
+{8,19,10,20},{2,20,10,21},{4,21,8,22},{1,7,11,9},{9,9,11,10},{8,10,10,12},{7,12,9,14},{6,14,8,16},{5,16,7,18},{4,18,6,20},
+{3,20,6,21},{3,21,5,22},{3,7,9,8},{2,8,10,9},{1,9,4,10},{8,9,11,10},{1,10,3,12},{9,10,11,12},{2,12,5,13},{7,12,10,13},
+{3,13,9,15},{2,15,5,16},{7,15,10,16},{1,16,4,17},{8,16,11,17},{1,17,3,19},{9,17,11,19},{1,19,4,20},{8,19,11,20},{2,20,10,21},
+{3,21,9,22},{4,7,8,8},{2,8,10,9},{2,9,4,10},{8,9,10,10},{1,10,3,13},{9,10,11,13},{1,13,4,14},{8,13,11,14},{2,14,11,15},
+{3,15,8,16},{9,15,11,17},{8,17,10,19},{6,19,9,20},{2,20,8,21},{2,21,7,22},{6,10,7,11},{5,11,8,13},{6,13,7,14},{6,18,7,19},
+{5,19,8,21},{6,21,7,22},{6,10,7,11},{5,11,8,13},{6,13,7,14},{5,18,8,19},{5,19,9,21},{6,21,9,23},{5,23,8,24},{3,24,7,25},
+{3,25,6,26},{9,9,10,10},{8,10,11,11},{7,11,10,12},{6,12,8,13},{4,13,7,14},{3,14,6,15},{2,15,5,16},{3,16,6,17},{4,17,7,18},
+{6,18,8,19},{7,19,10,20},{8,20,11,21},{9,21,10,22},{2,12,12,14},{2,16,12,18},{3,9,4,10},{2,10,5,11},{3,11,6,12},{5,12,7,13},
+{6,13,9,14},{7,14,10,15},{8,15,11,16},{7,16,10,17},{6,17,9,18},{5,18,7,19},{3,19,6,20},{2,20,5,21},{3,21,4,22},{4,5,7,6},
+{4,6,9,7},{7,7,10,8},{8,8,11,9},{9,9,11,12},{8,12,11,13},{6,13,10,15},{6,15,8,17},{5,19,8,22},{5,5,10,6},{4,6,6,7},
+{9,6,11,7},{3,7,5,8},{10,7,12,9},{2,8,4,10},{11,9,13,19},{1,10,3,13},{6,11,10,12},{5,12,10,13},{0,13,2,22},{5,13,7,14},
+{8,13,10,15},{4,14,6,20},{8,15,9,16},{7,16,9,20},{10,19,12,20},{4,20,12,21},{5,21,7,22},{8,21,11,22},{1,22,3,25},{2,25,5,26},
+{9,25,10,26},{4,26,9,27},{5,7,8,8},{5,8,6,9},{7,8,9,11},{4,9,6,12},{8,11,10,14},{3,12,5,15},{9,14,11,17},{3,15,4,16},
+{2,16,4,17},{2,17,12,19},{1,19,3,22},{10,19,13,20},{11,20,13,22},{2,7,9,8},{2,8,10,9},{2,9,4,13},{8,9,11,10},{9,10,11,12},
+{8,12,10,13},{2,13,9,14},{2,14,11,15},{2,15,4,20},{9,15,11,16},{10,16,12,19},{9,19,11,20},{2,20,11,21},{2,21,9,22},{5,7,10,8},
+{3,8,11,9},{2,9,5,10},{10,9,11,10},{2,10,4,11},{1,11,4,12},{1,12,3,17},{1,17,4,18},{2,18,4,19},{2,19,5,20},{10,19,11,20},
+{3,20,11,21},{5,21,10,22},{1,7,8,8},{1,8,10,9},{1,9,3,20},{8,9,11,10},{9,10,11,11},{10,11,12,17},{9,17,12,18},{9,18,11,19},
+{7,19,11,20},{1,20,10,21},{1,21,8,22},{2,7,11,9},{2,9,4,13},{2,13,11,15},{2,15,4,20},{2,20,11,22},{2,7,11,9},{2,9,4,13},
+{2,13,11,15},{2,15,4,22},{5,7,11,8},{4,8,12,9},{3,9,6,10},{11,9,12,10},{2,10,4,12},{1,12,3,17},{7,13,12,15},{10,15,12,20},
+{1,17,4,18},{2,18,4,19},{2,19,5,20},{3,20,12,21},{5,21,11,22},{1,7,3,13},{10,7,12,13},{1,13,12,15},{1,15,3,22},{10,15,12,22},
+{2,7,12,9},{6,9,8,20},{2,20,12,22},{2,7,10,9},{8,9,10,19},{2,19,3,20},{7,19,10,20},{2,20,9,21},{3,21,8,22},{2,7,4,14},
+{10,7,12,8},{9,8,11,9},{8,9,10,10},{7,10,9,11},{6,11,9,12},{6,12,8,13},{5,13,7,14},{2,14,6,15},{2,15,4,22},{5,15,7,16},
+{6,16,8,17},{6,17,9,18},{7,18,10,19},{8,19,10,20},{9,20,11,21},{10,21,12,22},{3,7,5,20},{3,20,12,22},{1,7,4,10},{9,7,12,10},
+{1,10,5,11},{8,10,12,11},{1,11,3,22},{4,11,5,12},{8,11,9,12},{10,11,12,20},{4,12,6,14},{7,12,9,14},{5,14,6,15},{7,14,8,15},
+{5,15,8,16},{6,16,7,17},{10,20,13,22},{1,7,4,8},{10,7,12,19},{1,8,5,10},{1,10,3,22},{4,10,6,12},{5,12,6,13},{5,13,7,14},
+{6,14,7,15},{6,15,8,17},{7,17,9,19},{8,19,12,21},{9,21,12,22},{5,7,10,8},{3,8,11,9},{2,9,5,10},{9,9,12,10},{2,10,4,11},
+{10,10,12,11},{1,11,3,18},{11,11,13,18},{2,18,4,19},{10,18,12,19},{2,19,5,20},{9,19,12,20},{3,20,11,21},{4,21,9,22},{2,7,9,8},
+{2,8,11,9},{2,9,4,15},{9,9,11,10},{10,10,12,14},{9,14,11,15},{2,15,10,16},{2,16,9,17},{2,17,4,22},{5,7,10,8},{3,8,11,9},
+{2,9,5,10},{9,9,12,10},{2,10,4,11},{10,10,12,11},{1,11,3,18},{11,11,13,18},{2,18,4,19},{10,18,12,19},{2,19,5,20},{9,19,12,20},
+{3,20,11,21},{4,21,9,22},{6,22,8,23},{6,23,9,24},{12,23,14,24},{7,24,14,25},{8,25,12,26},{2,7,9,8},{2,8,10,9},{2,9,4,14},
+{8,9,11,10},{9,10,11,13},{8,13,10,14},{2,14,10,15},{2,15,8,16},{2,16,4,22},{7,16,9,17},{7,17,10,18},{8,18,10,19},{8,19,11,20},
+{9,20,11,21},{9,21,12,22},{4,7,9,8},{2,8,10,9},{1,9,4,10},{9,9,10,10},{1,10,3,12},{1,12,4,13},{2,13,6,14},{4,14,9,15},
+{6,15,10,16},{8,16,11,17},{9,17,11,19},{1,19,2,20},{8,19,11,20},{1,20,10,21},{2,21,8,22},{1,7,13,9},{6,9,8,22},{1,7,3,19},
+{10,7,12,19},{1,19,4,20},{9,19,11,20},{2,20,11,21},{4,21,9,22},{0,7,2,9},{11,7,13,9},{0,9,3,10},{10,9,13,10},{1,10,3,12},
+{10,10,12,12},{2,12,4,14},{9,12,11,15},{2,14,5,15},{3,15,5,17},{8,15,10,17},{3,17,6,18},{7,17,10,18},{4,18,6,20},{7,18,9,20},
+{4,20,8,21},{5,21,8,22},{1,7,3,17},{10,7,12,17},{6,12,7,13},{6,13,8,14},{5,14,6,18},{7,14,8,17},{2,17,4,18},{7,17,9,18},
+{10,17,11,18},{2,18,6,20},{7,18,11,20},{2,20,5,22},{8,20,11,22},{1,7,4,8},{10,7,13,8},{2,8,4,9},{10,8,12,9},{3,9,5,10},
+{9,9,11,10},{3,10,6,11},{8,10,11,11},{4,11,6,12},{7,11,10,12},{4,12,9,13},{5,13,8,15},{5,15,9,16},{4,16,6,17},{7,16,10,17},
+{3,17,6,18},{8,17,10,18},{2,18,5,19},{8,18,11,19},{2,19,4,20},{9,19,11,20},{1,20,4,21},{9,20,12,21},{0,21,3,22},{10,21,13,22},
+{0,7,1,8},{11,7,13,8},{0,8,2,9},{10,8,12,9},{0,9,3,10},{9,9,12,10},{1,10,3,11},{9,10,11,11},{2,11,4,12},{8,11,10,13},
+{2,12,5,13},{3,13,5,14},{7,13,9,14},{3,14,9,15},{4,15,8,16},{5,16,7,22},{1,7,11,9},{8,9,10,10},{7,10,10,11},{7,11,9,12},
+{6,12,8,14},{5,14,7,15},{4,15,6,17},{3,17,5,18},{2,18,5,19},{2,19,4,20},{1,20,12,22},{4,5,10,7},{4,7,6,25},{4,25,10,27},
+{2,5,4,6},{3,6,5,9},{4,9,6,11},{5,11,7,14},{6,14,8,16},{7,16,9,19},{8,19,10,21},{9,21,11,24},{10,24,12,25},{3,5,9,7},
+{7,7,9,25},{3,25,9,27},{5,7,8,9},{4,9,6,10},{7,9,9,10},{4,10,5,11},{8,10,9,11},{3,11,5,12},{8,11,10,12},{2,12,4,14},
+{9,12,11,14},{0,25,13,27},{3,5,6,6},{4,6,7,7},{5,7,8,8},{4,10,10,11},{3,11,11,12},{3,12,4,13},{9,12,12,13},{10,13,12,15},
+{4,15,12,16},{3,16,12,17},{2,17,5,18},{10,17,12,19},{2,18,4,20},{8,19,12,20},{2,20,12,21},{4,21,9,22},{10,21,12,22},{2,5,4,11},
+{6,10,10,11},{2,11,11,12},{2,12,6,13},{9,12,11,13},{2,13,5,14},{10,13,12,18},{2,14,4,20},{9,18,12,19},{8,19,11,20},{2,20,10,21},
+{3,21,9,22},{5,10,10,11},{4,11,11,12},{3,12,6,13},{10,12,11,13},{2,13,5,14},{2,14,4,18},{2,18,5,19},{3,19,6,20},{10,19,11,20},
+{3,20,11,21},{5,21,10,22},{9,5,11,10},{4,10,11,11},{3,11,11,12},{2,12,5,13},{9,12,11,18},{1,13,4,14},{1,14,3,19},{8,18,11,19},
+{2,19,4,20},{7,19,11,20},{2,20,8,21},{9,20,11,22},{3,21,7,22},{4,10,8,11},{3,11,10,12},{2,12,4,13},{8,12,10,13},{1,13,3,15},
+{9,13,11,15},{1,15,11,17},{1,17,3,19},{2,19,4,20},{9,19,10,20},{2,20,10,21},{4,21,9,22},{7,5,12,6},{6,6,12,7},{5,7,8,8},
+{5,8,7,11},{1,11,11,13},{5,13,7,22},{4,10,12,11},{3,11,12,12},{2,12,5,13},{8,12,11,13},{2,13,4,15},{9,13,11,15},{2,15,5,16},
+{8,15,11,16},{3,16,10,17},{2,17,9,18},{1,18,3,20},{2,20,10,21},{2,21,12,22},{1,22,3,24},{10,22,12,24},{1,24,4,25},{9,24,12,25},
+{2,25,11,26},{3,26,9,27},{2,5,4,11},{6,10,9,11},{2,11,10,12},{2,12,6,13},{8,12,11,13},{2,13,5,14},{9,13,11,22},{2,14,4,22},
+{5,5,8,8},{2,10,8,12},{6,12,8,20},{2,20,11,22},{7,5,10,8},{2,10,10,12},{8,12,10,24},{2,24,3,25},{7,24,9,25},{2,25,9,26},
+{3,26,8,27},{2,5,4,15},{9,10,12,11},{8,11,11,12},{7,12,10,13},{6,13,9,14},{5,14,7,15},{2,15,6,16},{2,16,4,22},{5,16,7,17},
+{6,17,8,18},{7,18,9,19},{8,19,10,20},{9,20,11,21},{10,21,12,22},{2,5,8,7},{6,7,8,20},{2,20,11,22},{1,10,3,11},{4,10,7,11},
+{9,10,12,11},{1,11,13,12},{1,12,4,14},{6,12,9,14},{11,12,13,22},{1,14,3,22},{6,14,8,22},{2,10,4,11},{6,10,9,11},{2,11,10,12},
+{2,12,6,13},{8,12,11,13},{2,13,5,14},{9,13,11,22},{2,14,4,22},{4,10,9,11},{3,11,11,12},{2,12,5,13},{8,12,11,13},{1,13,4,14},
+{9,13,12,14},{1,14,3,18},{10,14,12,18},{1,18,4,19},{9,18,12,19},{2,19,5,20},{8,19,11,20},{2,20,10,21},{4,21,9,22},{2,10,4,11},
+{6,10,10,11},{2,11,11,12},{2,12,6,13},{9,12,11,13},{2,13,5,14},{10,13,12,18},{2,14,4,20},{9,18,12,19},{8,19,11,20},{2,20,10,21},
+{2,21,9,22},{2,22,4,27},{4,10,11,11},{3,11,11,12},{2,12,5,13},{9,12,11,18},{1,13,4,14},{1,14,3,19},{8,18,11,19},{2,19,4,20},
+{7,19,11,20},{2,20,11,21},{3,21,7,22},{9,21,11,27},{2,10,4,12},{6,10,10,11},{5,11,11,12},{2,12,6,13},{9,12,12,13},{2,13,5,14},
+{10,13,12,15},{2,14,4,22},{4,10,9,11},{3,11,10,12},{2,12,4,14},{9,12,10,13},{2,14,5,15},{3,15,8,16},{5,16,10,17},{8,17,11,18},
+{9,18,11,20},{2,19,3,20},{2,20,10,21},{3,21,9,22},{5,6,6,7},{4,7,6,10},{1,10,12,12},{4,12,6,18},{4,18,7,19},{5,19,7,20},
+{5,20,12,21},{6,21,12,22},{2,10,4,19},{9,10,11,18},{8,18,11,19},{2,19,5,20},{7,19,11,20},{3,20,11,21},{4,21,7,22},{9,21,11,22},
+{1,10,3,12},{10,10,12,12},{1,12,4,13},{9,12,11,15},{2,13,4,15},{3,15,5,18},{8,15,10,17},{8,17,9,18},{4,18,6,20},{7,18,9,20},
+{5,20,6,21},{7,20,8,21},{5,21,8,22},{1,10,3,18},{10,10,12,17},{6,13,7,14},{5,14,8,15},{5,15,6,17},{7,15,8,17},{4,17,6,19},
+{7,17,9,19},{10,17,11,20},{2,18,3,20},{4,19,5,20},{8,19,9,20},{2,20,5,22},{8,20,11,22},{1,10,4,11},{9,10,12,11},{2,11,5,12},
+{9,11,11,12},{3,12,5,13},{8,12,10,13},{3,13,6,14},{7,13,10,14},{4,14,9,15},{5,15,8,17},{4,17,6,18},{7,17,9,18},{3,18,6,19},
+{7,18,10,19},{3,19,5,20},{8,19,10,20},{2,20,5,21},{8,20,11,21},{1,21,4,22},{9,21,12,22},{1,10,3,12},{10,10,12,12},{1,12,4,13},
+{9,12,11,15},{2,13,4,15},{3,15,5,17},{8,15,10,17},{3,17,6,18},{7,17,9,19},{4,18,6,20},{7,19,8,20},{5,20,8,22},{5,22,7,23},
+{4,23,7,24},{3,24,6,25},{0,25,5,26},{0,26,4,27},{2,10,11,12},{8,12,10,13},{7,13,9,15},{6,15,8,16},{5,16,7,17},{4,17,6,19},
+{3,19,5,20},{2,20,11,22},{7,5,10,6},{6,6,10,7},{5,7,8,8},{5,8,7,13},{4,13,7,14},{2,14,6,16},{4,16,7,17},{5,17,7,24},
+{5,24,8,25},{6,25,10,26},{7,26,10,27},{6,3,8,27},{3,5,6,6},{3,6,7,7},{5,7,8,8},{6,8,8,13},{6,13,9,14},{7,14,11,16},
+{6,16,9,17},{6,17,8,24},{5,24,8,25},{3,25,7,26},{3,26,6,27},{3,13,6,14},{2,14,7,15},{11,14,13,16},{1,15,3,17},{6,15,8,16},
+{7,16,12,17},{8,17,11,18},
+};
+const Font font = { 14, 28, 32, 126, glyphs, spans };
+}
+
+namespace spans32 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{6,6,9,25,0,2},
+{3,6,11,12,2,2},
+{1,8,15,25,4,11},
+{2,5,14,28,15,23},
+{0,6,15,25,38,28},
+{1,6,15,25,66,25},
+{6,6,9,12,91,1},
+{3,5,11,30,92,14},
+{4,5,12,30,106,14},
+{3,6,13,17,120,12},
+{1,12,14,24,132,3},
+{3,21,9,30,135,6},
+{3,17,11,19,141,1},
+{5,21,9,25,142,3},
+{2,6,13,28,145,14},
+{1,8,14,25,159,21},
+{2,8,13,25,180,7},
+{2,8,13,25,187,14},
+{2,8,13,25,201,13},
+{1,8,15,25,214,14},
+{2,8,13,25,228,10},
+{2,8,14,25,238,17},
+{2,8,14,25,255,16},
+{2,8,14,25,271,21},
+{1,8,14,25,292,19},
+{5,12,9,25,311,6},
+{4,12,10,30,317,9},
+{2,10,12,25,326,15},
+{2,14,13,21,341,2},
+{3,10,13,25,343,15},
+{4,6,13,25,358,10},
+{0,6,15,30,368,32},
+{1,8,14,25,400,17},
+{2,8,14,25,417,14},
+{1,8,13,25,431,12},
+{1,8,14,25,443,10},
+{3,8,13,25,453,5},
+{3,8,13,25,458,4},
+{1,8,14,25,462,14},
+{1,8,13,25,476,5},
+{2,8,13,25,481,3},
+{2,8,12,25,484,6},
+{2,8,14,25,490,19},
+{3,8,13,25,509,2},
+{1,8,15,25,511,18},
+{2,8,13,25,529,11},
+{1,8,14,25,540,16},
+{2,8,14,25,556,10},
+{1,8,16,30,566,20},
+{2,8,14,25,586,14},
+{2,8,14,25,600,15},
+{1,8,14,25,615,2},
+{1,8,14,25,617,7},
+{1,8,14,25,624,20},
+{1,8,14,25,644,16},
+{0,8,15,25,660,23},
+{0,8,15,25,683,16},
+{1,8,14,25,699,15},
+{4,6,11,30,714,3},
+{2,6,13,28,717,14},
+{4,6,11,30,731,3},
+{2,8,13,16,734,11},
+{0,28,15,30,745,1},
+{3,7,8,10,746,3},
+{2,12,14,25,749,15},
+{2,6,14,25,764,12},
+{2,12,12,25,776,11},
+{1,6,13,25,787,13},
+{2,12,14,25,800,14},
+{1,6,14,25,814,6},
+{1,12,14,30,820,19},
+{2,6,13,25,839,8},
+{2,7,13,25,847,6},
+{1,7,11,30,853,9},
+{2,6,13,25,862,13},
+{2,6,13,25,875,3},
+{1,12,14,25,878,10},
+{2,12,13,25,888,8},
+{1,12,14,25,896,14},
+{2,12,14,30,910,13},
+{1,12,13,30,923,12},
+{3,12,15,25,935,8},
+{2,12,13,25,943,14},
+{1,8,13,25,957,6},
+{2,12,13,25,963,8},
+{1,12,13,25,971,15},
+{1,12,14,25,986,14},
+{1,12,14,25,1000,23},
+{0,12,13,30,1023,21},
+{2,12,12,25,1044,11},
+{2,6,12,30,1055,11},
+{6,3,9,30,1066,1},
+{3,6,13,30,1067,11},
+{1,15,15,20,1078,7},
+};
+const GlyphSpan spans[] = {
+{6,6,9,20},{6,22,9,25},{3,6,6,12},{8,6,11,12},{5,8,7,12},{10,8,13,12},{2,12,15,14},{4,14,7,16},{9,14,12,18},{4,16,6,18},
+{1,18,14,20},{4,20,6,21},{9,20,12,21},{3,21,6,25},{8,21,11,25},{9,5,11,6},{8,6,10,8},{5,8,12,9},{4,9,13,10},{3,10,6,11},
+{8,10,10,13},{12,10,13,11},{2,11,5,14},{8,13,9,14},{3,14,9,15},{4,15,9,16},{5,16,11,17},{7,17,13,18},{7,18,9,20},{10,18,14,19},
+{11,19,14,22},{6,20,8,23},{2,22,3,23},{10,22,13,23},{2,23,13,24},{3,24,11,25},{6,25,8,27},{5,27,7,28},{2,6,6,7},{12,6,14,7},
+{1,7,7,8},{11,7,13,8},{0,8,3,12},{5,8,8,12},{10,8,13,9},{10,9,12,10},{9,10,11,12},{1,12,7,13},{8,12,10,13},{2,13,6,14},
+{7,13,9,15},{6,15,8,16},{5,16,8,17},{5,17,7,18},{9,17,13,18},{4,18,6,19},{8,18,14,19},{3,19,6,20},{7,19,10,23},{12,19,15,23},
+{3,20,5,21},{2,21,4,23},{1,23,3,24},{8,23,14,24},{0,24,2,25},{9,24,13,25},{5,6,10,7},{3,7,11,8},{2,8,6,9},{8,8,12,9},
+{2,9,5,13},{9,9,12,12},{8,12,11,13},{3,13,6,14},{7,13,10,14},{3,14,9,15},{3,15,7,16},{2,16,8,17},{11,16,14,19},{2,17,5,18},
+{6,17,9,18},{1,18,4,22},{7,18,10,20},{11,19,13,20},{8,20,13,21},{9,21,12,22},{1,22,5,23},{8,22,13,23},{2,23,14,24},{4,24,9,25},
+{12,24,15,25},{6,6,9,12},{9,5,10,6},{8,6,11,7},{7,7,10,8},{6,8,9,9},{6,9,8,10},{5,10,8,11},{4,11,7,14},{3,14,6,21},
+{4,21,7,24},{5,24,8,26},{6,26,9,27},{7,27,10,28},{8,28,11,29},{9,29,10,30},{5,5,6,6},{4,6,7,7},{5,7,8,8},{6,8,9,9},
+{7,9,10,11},{8,11,11,14},{9,14,12,21},{8,21,11,24},{7,24,10,25},{7,25,9,26},{6,26,9,27},{5,27,8,28},{4,28,7,29},{5,29,6,30},
+{7,6,9,10},{4,8,5,9},{11,8,12,9},{3,9,6,10},{10,9,13,10},{5,10,11,11},{7,11,9,12},{5,12,11,13},{3,13,6,14},{7,13,9,17},
+{10,13,13,14},{11,14,12,15},{6,12,9,17},{1,17,14,19},{6,19,9,24},{5,21,8,22},{5,22,9,24},{6,24,9,27},{5,27,8,28},{3,28,7,29},
+{3,29,6,30},{3,17,11,19},{6,21,8,22},{5,22,9,24},{6,24,8,25},{11,6,13,7},{10,7,13,8},{10,8,12,10},{9,10,11,12},{8,12,11,13},
+{8,13,10,15},{7,15,9,17},{6,17,8,19},{5,19,8,20},{5,20,7,22},{4,22,6,24},{3,24,6,25},{3,25,5,27},{2,27,4,28},{5,8,10,9},
+{3,9,12,10},{3,10,6,11},{9,10,13,11},{2,11,5,13},{10,11,13,13},{1,13,4,18},{10,13,14,14},{9,14,14,15},{7,15,10,16},{11,15,14,20},
+{6,16,9,17},{5,17,8,18},{1,18,6,19},{1,19,5,20},{2,20,5,22},{10,20,13,22},{2,22,6,23},{9,22,12,23},{3,23,12,24},{5,24,10,25},
+{7,8,10,9},{5,9,10,10},{3,10,6,11},{7,10,10,23},{2,11,5,12},{3,12,4,13},{3,23,13,25},{4,8,9,9},{3,9,11,10},{2,10,5,11},
+{8,10,11,11},{3,11,4,12},{9,11,12,15},{8,15,11,17},{7,17,10,18},{6,18,9,19},{5,19,8,20},{4,20,7,21},{3,21,6,22},{3,22,5,23},
+{2,23,13,25},{3,8,9,9},{2,9,11,10},{2,10,3,11},{8,10,12,11},{9,11,12,14},{8,14,11,15},{4,15,10,16},{4,16,11,17},{8,17,12,18},
+{10,18,13,22},{8,22,12,23},{2,23,11,24},{2,24,9,25},{9,8,13,9},{8,9,13,10},{7,10,13,11},{6,11,9,12},{10,11,13,19},{6,12,8,13},
+{5,13,7,14},{4,14,7,15},{4,15,6,16},{3,16,5,17},{2,17,4,18},{1,18,4,19},{1,19,15,21},{10,21,13,25},{2,8,12,10},{2,10,5,15},
+{2,15,10,16},{2,16,12,17},{8,17,13,18},{10,18,13,21},{9,21,13,22},{8,22,12,23},{2,23,11,24},{2,24,9,25},{7,8,13,9},{5,9,13,10},
+{4,10,8,11},{3,11,7,12},{3,12,6,13},{3,13,5,14},{2,14,5,16},{6,15,12,16},{2,16,13,17},{2,17,6,18},{10,17,14,18},{2,18,5,21},
+{11,18,14,22},{3,21,6,23},{10,22,13,23},{4,23,12,24},{5,24,11,25},{2,8,14,10},{11,10,14,11},{11,11,13,12},{10,12,13,13},{10,13,12,14},
+{9,14,12,15},{9,15,11,16},{8,16,11,17},{8,17,10,18},{7,18,10,19},{7,19,9,20},{6,20,9,21},{6,21,8,22},{5,22,8,23},{5,23,7,24},
+{4,24,7,25},{5,8,11,9},{3,9,13,10},{2,10,6,11},{10,10,14,11},{2,11,5,13},{11,11,14,14},{2,13,6,14},{3,14,7,15},{9,14,13,15},
+{4,15,11,16},{5,16,12,17},{3,17,7,18},{9,17,13,18},{3,18,6,19},{10,18,14,19},{2,19,5,22},{11,19,14,22},{2,22,6,23},{10,22,14,23},
+{3,23,13,24},{5,24,11,25},{5,8,10,9},{3,9,12,10},{2,10,6,11},{9,10,13,11},{1,11,5,12},{10,11,13,12},{1,12,4,16},{11,12,14,16},
+{2,16,5,17},{10,16,14,17},{2,17,14,18},{4,18,10,19},{11,18,14,19},{11,19,13,20},{10,20,13,21},{9,21,12,22},{8,22,12,23},{2,23,10,24},
+{2,24,8,25},{6,12,8,13},{5,13,9,15},{6,15,8,16},{6,21,8,22},{5,22,9,24},{6,24,8,25},{7,12,9,13},{6,13,10,15},{7,15,9,16},
+{6,21,9,22},{6,22,10,24},{7,24,10,27},{6,27,9,28},{4,28,8,29},{4,29,7,30},{10,10,11,11},{9,11,12,12},{8,12,11,13},{7,13,10,14},
+{5,14,8,15},{4,15,7,16},{3,16,6,17},{2,17,5,18},{3,18,6,19},{4,19,7,20},{5,20,9,21},{7,21,10,22},{8,22,11,23},{9,23,12,24},
+{10,24,11,25},{2,14,13,16},{2,19,13,21},{4,10,5,11},{3,11,6,12},{4,12,7,13},{5,13,8,14},{6,14,10,15},{8,15,11,16},{9,16,12,17},
+{10,17,13,18},{9,18,12,19},{8,19,11,20},{7,20,10,21},{5,21,8,22},{4,22,7,23},{3,23,6,24},{4,24,5,25},{4,6,8,7},{4,7,10,8},
+{7,8,11,9},{9,9,12,10},{10,10,13,14},{9,14,13,15},{6,15,12,16},{6,16,11,17},{6,17,9,20},{5,22,8,25},{6,6,11,7},{5,7,13,8},
+{4,8,7,9},{11,8,13,9},{3,9,5,10},{12,9,14,11},{2,10,5,11},{2,11,4,12},{13,11,15,21},{1,12,3,15},{7,13,12,14},{6,14,12,15},
+{0,15,2,24},{5,15,8,16},{10,15,12,16},{5,16,7,17},{9,16,12,17},{4,17,7,22},{9,17,11,21},{8,21,11,22},{12,21,14,22},{4,22,9,23},
+{10,22,14,23},{5,23,8,24},{10,23,13,24},{0,24,3,25},{1,25,3,26},{1,26,4,27},{2,27,5,28},{10,27,11,28},{3,28,11,29},{4,29,10,30},
+{6,8,9,9},{6,9,7,10},{8,9,10,12},{5,10,7,13},{8,12,11,13},{4,13,6,16},{9,13,11,15},{9,15,12,16},{3,16,5,19},{10,16,12,19},
+{2,19,13,21},{2,21,4,22},{11,21,13,22},{1,22,4,23},{11,22,14,23},{1,23,3,25},{12,23,14,25},{2,8,11,9},{2,9,12,10},{2,10,5,15},
+{9,10,13,11},{10,11,13,14},{9,14,12,15},{2,15,11,16},{2,16,12,17},{2,17,5,23},{10,17,13,18},{11,18,14,22},{10,22,13,23},{2,23,12,24},
+{2,24,10,25},{6,8,12,9},{4,9,13,10},{3,10,7,11},{12,10,13,11},{2,11,6,12},{2,12,5,13},{1,13,4,20},{2,20,5,22},{3,22,7,23},
+{12,22,13,23},{4,23,13,24},{5,24,12,25},{1,8,9,9},{1,9,11,10},{1,10,4,23},{9,10,12,11},{10,11,13,13},{11,13,14,20},{10,20,13,22},
+{8,22,12,23},{1,23,11,24},{1,24,9,25},{3,8,13,10},{3,10,6,15},{3,15,13,17},{3,17,6,23},{3,23,13,25},{3,8,13,10},{3,10,6,15},
+{3,15,13,17},{3,17,6,25},{6,8,13,9},{4,9,14,10},{3,10,7,11},{13,10,14,11},{2,11,6,12},{2,12,5,13},{1,13,5,14},{1,14,4,20},
+{8,15,14,17},{11,17,14,23},{2,20,5,22},{3,22,7,23},{4,23,14,24},{6,24,12,25},{1,8,4,15},{10,8,13,15},{1,15,13,17},{1,17,4,25},
+{10,17,13,25},{2,8,13,10},{6,10,9,23},{2,23,13,25},{2,8,12,10},{9,10,12,22},{2,22,3,23},{8,22,11,23},{2,23,10,24},{3,24,9,25},
+{2,8,5,16},{11,8,13,9},{10,9,13,10},{9,10,12,11},{8,11,11,12},{8,12,10,13},{7,13,9,14},{6,14,9,15},{6,15,8,16},{2,16,7,17},
+{2,17,5,25},{6,17,8,18},{6,18,9,19},{7,19,10,20},{8,20,10,21},{8,21,11,22},{9,22,12,23},{10,23,13,24},{11,24,14,25},{3,8,6,23},
+{3,23,13,25},{2,8,5,11},{10,8,13,9},{10,9,14,10},{10,10,11,11},{12,10,14,21},{2,11,6,13},{9,11,11,13},{2,13,4,17},{5,13,6,14},
+{9,13,10,14},{5,14,7,16},{8,14,10,15},{8,15,9,17},{6,16,7,17},{1,17,4,25},{6,17,9,18},{6,18,8,19},{12,21,15,25},{2,8,6,11},
+{10,8,13,20},{2,11,7,12},{2,12,5,25},{6,12,7,14},{6,14,8,15},{7,15,8,17},{7,17,9,19},{8,19,9,20},{8,20,13,22},{9,22,13,25},
+{5,8,10,9},{4,9,12,10},{3,10,6,11},{9,10,13,11},{2,11,5,13},{10,11,13,12},{10,12,14,13},{1,13,4,20},{11,13,14,20},{1,20,5,21},
+{10,20,13,22},{2,21,5,22},{2,22,6,23},{9,22,12,23},{3,23,11,24},{5,24,10,25},{2,8,11,9},{2,9,12,10},{2,10,5,17},{9,10,13,11},
+{11,11,14,15},{10,15,14,16},{9,16,13,17},{2,17,12,18},{2,18,10,19},{2,19,5,25},{5,8,11,9},{4,9,13,10},{3,10,6,11},{10,10,14,11},
+{2,11,5,13},{11,11,14,13},{1,13,4,20},{12,13,15,20},{1,20,5,21},{11,20,14,22},{2,21,5,22},{2,22,6,23},{10,22,13,23},{3,23,12,24},
+{5,24,11,25},{7,25,10,27},{8,27,11,28},{14,27,15,28},{8,28,16,29},{10,29,15,30},{2,8,10,9},{2,9,12,10},{2,10,5,16},{9,10,13,11},
+{10,11,13,15},{9,15,12,16},{2,16,11,17},{2,17,10,18},{2,18,5,25},{8,18,11,19},{9,19,12,21},{10,21,13,23},{11,23,13,24},{11,24,14,25},
+{5,8,12,9},{4,9,13,10},{3,10,6,11},{12,10,13,11},{2,11,5,14},{3,14,7,15},{3,15,9,16},{5,16,11,17},{8,17,13,18},{10,18,14,19},
+{11,19,14,22},{2,22,3,23},{10,22,13,23},{2,23,12,24},{3,24,11,25},{1,8,14,10},{6,10,9,25},{1,8,4,22},{11,8,14,21},{10,21,14,22},
+{2,22,5,23},{10,22,13,23},{3,23,12,24},{4,24,10,25},{1,8,3,9},{12,8,14,10},{1,9,4,11},{11,10,14,11},{2,11,4,13},{11,11,13,13},
+{2,13,5,14},{10,13,13,14},{3,14,5,16},{10,14,12,16},{3,16,6,18},{9,16,12,17},{9,17,11,19},{4,18,6,19},{4,19,7,21},{8,19,11,20},
+{8,20,10,23},{5,21,7,23},{5,23,9,24},{6,24,9,25},{1,8,4,19},{11,8,14,19},{7,14,9,15},{6,15,9,17},{6,17,7,18},{8,17,9,18},
+{5,18,7,20},{8,18,10,20},{2,19,4,21},{11,19,13,21},{5,20,6,21},{9,20,10,21},{2,21,6,23},{9,21,13,23},{2,23,5,25},{10,23,13,25},
+{1,8,4,9},{11,8,14,9},{2,9,5,10},{10,9,13,10},{3,10,5,11},{10,10,12,11},{3,11,6,12},{9,11,12,12},{4,12,7,13},{8,12,11,13},
+{5,13,10,15},{6,15,9,17},{5,17,10,18},{4,18,7,20},{8,18,11,20},{3,20,6,21},{9,20,12,21},{2,21,5,23},{10,21,13,23},{1,23,4,24},
+{11,23,14,24},{0,24,3,25},{12,24,15,25},{0,8,3,9},{12,8,15,9},{1,9,4,11},{11,9,14,11},{2,11,5,13},{10,11,13,13},{3,13,6,14},
+{9,13,12,14},{4,14,6,15},{9,14,11,15},{4,15,7,16},{8,15,11,16},{5,16,7,17},{8,16,10,17},{5,17,10,18},{6,18,9,25},{1,8,13,10},
+{10,10,12,11},{9,11,11,12},{8,12,11,13},{8,13,10,14},{7,14,10,15},{7,15,9,16},{6,16,8,17},{5,17,8,18},{5,18,7,19},{4,19,6,20},
+{3,20,6,21},{3,21,5,22},{2,22,4,23},{1,23,14,25},{4,6,11,8},{4,8,7,28},{4,28,11,30},{2,6,4,7},{3,7,5,9},{3,9,6,10},
+{4,10,6,12},{5,12,7,14},{5,14,8,15},{6,15,8,17},{7,17,9,19},{8,19,10,21},{8,21,11,22},{9,22,11,24},{10,24,12,26},{10,26,13,27},
+{11,27,13,28},{4,6,11,8},{8,8,11,28},{4,28,11,30},{6,8,9,10},{5,10,7,11},{8,10,10,11},{4,11,7,12},{8,11,11,12},{4,12,6,13},
+{9,12,11,13},{3,13,6,14},{9,13,12,14},{2,14,5,16},{10,14,13,16},{0,28,15,30},{3,7,6,8},{4,8,7,9},{5,9,8,10},{5,12,11,13},
+{3,13,13,14},{3,14,4,15},{10,14,14,15},{11,15,14,17},{5,17,14,18},{3,18,14,19},{2,19,6,20},{11,19,14,22},{2,20,5,22},{2,22,6,23},
+{9,22,14,23},{3,23,14,24},{4,24,9,25},{11,24,14,25},{2,6,5,14},{7,12,11,13},{6,13,13,14},{2,14,7,15},{10,14,13,15},{2,15,6,16},
+{11,15,14,21},{2,16,5,23},{10,21,13,22},{9,22,13,23},{2,23,12,24},{3,24,10,25},{6,12,11,13},{4,13,12,14},{3,14,7,15},{11,14,12,15},
+{3,15,6,16},{2,16,5,21},{2,21,6,22},{3,22,7,23},{11,22,12,23},{4,23,12,24},{5,24,11,25},{10,6,13,12},{5,12,13,13},{3,13,13,14},
+{2,14,6,15},{10,14,13,21},{2,15,5,16},{1,16,4,22},{9,21,13,22},{2,22,5,23},{8,22,13,23},{2,23,9,24},{10,23,13,25},{4,24,8,25},
+{6,12,11,13},{4,13,12,14},{3,14,6,15},{10,14,13,15},{3,15,5,16},{11,15,14,17},{2,16,5,17},{2,17,14,19},{2,19,5,21},{2,21,6,22},
+{3,22,7,23},{12,22,13,23},{4,23,13,24},{5,24,12,25},{8,6,14,7},{6,7,14,8},{6,8,9,9},{5,9,8,13},{1,13,13,15},{5,15,8,25},
+{5,12,14,13},{3,13,14,14},{2,14,6,15},{9,14,13,15},{2,15,5,18},{10,15,13,18},{2,18,6,19},{9,18,13,19},{3,19,12,20},{2,20,10,21},
+{2,21,5,23},{2,23,12,24},{3,24,14,25},{1,25,4,27},{11,25,14,27},{1,27,5,28},{10,27,14,28},{2,28,13,29},{3,29,11,30},{2,6,5,14},
+{7,12,11,13},{6,13,12,14},{2,14,7,15},{9,14,13,15},{2,15,6,16},{10,15,13,25},{2,16,5,25},{7,7,9,8},{6,8,10,9},{7,9,9,10},
+{2,12,10,14},{7,14,10,23},{2,23,13,25},{8,7,10,8},{7,8,11,9},{8,9,10,10},{2,12,11,14},{8,14,11,27},{1,27,2,28},{7,27,10,28},
+{1,28,9,29},{2,29,8,30},{2,6,5,17},{10,12,13,13},{9,13,12,14},{8,14,11,15},{7,15,10,16},{6,16,9,17},{2,17,8,18},{2,18,5,25},
+{6,18,9,20},{7,20,10,21},{8,21,11,23},{9,23,12,24},{10,24,13,25},{2,6,10,8},{7,8,10,23},{2,23,13,25},{1,12,4,13},{5,12,8,13},
+{10,12,13,13},{1,13,8,14},{9,13,14,14},{1,14,5,15},{6,14,10,15},{11,14,14,25},{1,15,4,25},{6,15,9,25},{2,12,5,13},{7,12,11,13},
+{2,13,12,14},{2,14,7,15},{9,14,13,15},{2,15,6,16},{10,15,13,25},{2,16,5,25},{5,12,11,13},{3,13,12,14},{2,14,6,15},{9,14,13,15},
+{2,15,5,16},{10,15,14,16},{1,16,4,21},{11,16,14,21},{2,21,5,22},{10,21,13,22},{2,22,6,23},{9,22,13,23},{3,23,12,24},{4,24,10,25},
+{2,12,5,13},{7,12,11,13},{2,13,13,14},{2,14,7,15},{10,14,13,15},{2,15,6,16},{11,15,14,21},{2,16,5,23},{10,21,13,22},{9,22,13,23},
+{2,23,12,24},{2,24,10,25},{2,25,5,30},{5,12,13,13},{3,13,13,14},{2,14,6,15},{10,14,13,21},{2,15,5,16},{1,16,4,22},{9,21,13,22},
+{2,22,5,23},{8,22,13,23},{2,23,9,24},{10,23,13,30},{4,24,8,25},{3,12,6,14},{8,12,13,13},{7,13,14,14},{3,14,8,15},{11,14,15,15},
+{3,15,7,16},{12,15,15,17},{3,16,6,25},{5,12,11,13},{3,13,12,14},{2,14,6,15},{11,14,12,15},{2,15,5,16},{2,16,6,17},{3,17,8,18},
+{4,18,11,19},{7,19,12,20},{10,20,13,22},{2,22,3,23},{9,22,13,23},{2,23,12,24},{3,24,10,25},{5,8,8,12},{1,12,13,14},{5,14,8,22},
+{5,22,9,23},{6,23,13,24},{7,24,13,25},{2,12,5,22},{10,12,13,21},{9,21,13,22},{2,22,6,23},{8,22,13,23},{3,23,13,24},{4,24,8,25},
+{10,24,13,25},{1,12,3,13},{11,12,13,14},{1,13,4,14},{2,14,4,16},{10,14,13,15},{10,15,12,17},{2,16,5,17},{3,17,5,18},{9,17,11,20},
+{3,18,6,19},{4,19,6,21},{8,20,10,23},{5,21,7,23},{5,23,9,24},{6,24,9,25},{1,12,3,17},{12,12,14,21},{7,15,9,16},{6,16,9,18},
+{1,17,4,18},{2,18,4,23},{6,18,7,20},{8,18,10,20},{5,20,7,21},{9,20,11,23},{5,21,6,23},{12,21,13,23},{3,23,6,25},{10,23,13,25},
+{1,12,4,13},{11,12,14,13},{2,13,5,14},{10,13,13,14},{3,14,6,15},{9,14,12,15},{4,15,6,16},{9,15,11,16},{4,16,7,17},{8,16,11,17},
+{5,17,10,18},{6,18,9,19},{5,19,10,20},{5,20,7,21},{8,20,11,21},{4,21,6,22},{9,21,11,22},{3,22,6,23},{9,22,12,23},{2,23,5,24},
+{10,23,13,24},{1,24,4,25},{11,24,14,25},{1,12,3,13},{11,12,13,13},{1,13,4,14},{10,13,13,15},{2,14,4,15},{2,15,5,17},{10,15,12,17},
+{3,17,5,18},{9,17,11,20},{3,18,6,19},{4,19,6,20},{4,20,7,21},{8,20,10,22},{5,21,7,23},{8,22,9,23},{6,23,9,25},{6,25,8,26},
+{5,26,8,27},{4,27,7,28},{0,28,6,29},{0,29,4,30},{2,12,12,14},{9,14,11,15},{8,15,10,16},{7,16,10,17},{7,17,9,18},{6,18,8,19},
+{5,19,7,20},{4,20,7,21},{4,21,6,22},{3,22,5,23},{2,23,12,25},{8,6,12,7},{7,7,12,8},{6,8,10,9},{6,9,9,15},{5,15,9,16},
+{2,16,8,18},{5,18,9,19},{6,19,9,27},{6,27,10,28},{7,28,12,29},{8,29,12,30},{6,3,9,30},{3,6,7,7},{3,7,8,8},{5,8,9,9},
+{6,9,9,15},{6,15,10,16},{7,16,13,18},{6,18,10,19},{6,19,9,27},{5,27,9,28},{3,28,8,29},{3,29,7,30},{3,15,7,16},{2,16,8,17},
+{12,16,15,18},{1,17,4,19},{7,17,9,18},{8,18,14,19},{9,19,13,20},
+};
+const Font font = { 16, 32, 32, 126, glyphs, spans };
+}
+
+namespace spans40 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{7,7,11,31,0,4},
+{4,7,15,15,4,2},
+{1,9,18,31,6,11},
+{2,6,17,35,17,28},
+{0,7,18,31,45,44},
+{1,7,19,31,89,34},
+{8,7,12,15,123,1},
+{5,6,14,38,124,19},
+{5,6,14,38,143,20},
+{3,7,15,21,163,16},
+{1,14,18,30,179,3},
+{4,26,12,37,182,10},
+{4,21,14,23,192,1},
+{6,25,12,31,193,3},
+{2,7,16,35,196,19},
+{1,9,17,31,215,30},
+{2,9,17,31,245,8},
+{2,9,16,31,253,19},
+{3,9,17,31,272,17},
+{1,9,18,31,289,14},
+{3,9,16,31,303,11},
+{2,9,17,31,314,22},
+{2,9,17,31,336,14},
+{2,9,17,31,350,28},
+{2,9,17,31,378,22},
+{7,14,12,31,400,6},
+{4,14,12,37,406,13},
+{2,12,15,31,419,19},
+{2,18,16,25,438,2},
+{3,12,16,31,440,19},
+{5,7,15,31,459,13},
+{0,7,18,38,472,39},
+{1,9,18,31,511,20},
+{3,9,17,31,531,18},
+{2,9,17,31,549,16},
+{2,9,18,31,565,14},
+{3,9,15,31,579,5},
+{3,9,15,31,584,4},
+{1,9,17,31,588,16},
+{2,9,17,31,604,5},
+{3,9,16,31,609,3},
+{3,9,15,31,612,8},
+{3,9,17,31,620,23},
+{4,9,16,31,643,2},
+{1,9,18,31,645,17},
+{2,9,17,31,662,19},
+{1,9,18,31,681,19},
+{3,9,17,31,700,11},
+{1,9,19,37,711,25},
+{3,9,18,31,736,20},
+{2,9,16,31,756,20},
+{2,9,17,31,776,2},
+{2,9,17,31,778,9},
+{1,9,18,31,787,19},
+{2,9,18,31,806,19},
+{0,9,19,31,825,38},
+{0,9,19,31,863,19},
+{2,9,17,31,882,15},
+{5,7,13,38,897,3},
+{3,7,17,35,900,19},
+{5,7,13,38,919,3},
+{3,9,17,20,922,13},
+{0,36,19,38,935,1},
+{4,7,11,11,936,4},
+{2,14,16,31,940,17},
+{3,7,17,31,957,15},
+{3,14,16,31,972,14},
+{2,7,16,31,986,15},
+{2,14,17,31,1001,15},
+{1,7,18,31,1016,7},
+{2,14,19,38,1023,26},
+{3,7,17,31,1049,9},
+{3,8,16,31,1058,6},
+{2,8,15,38,1064,10},
+{3,7,18,31,1074,19},
+{3,7,16,31,1093,3},
+{1,14,18,31,1096,13},
+{3,14,17,31,1109,9},
+{2,14,18,31,1118,16},
+{3,14,17,38,1134,16},
+{2,14,16,38,1150,16},
+{3,14,17,31,1166,9},
+{3,14,16,31,1175,15},
+{1,9,16,31,1190,8},
+{3,14,17,31,1198,9},
+{2,14,17,31,1207,16},
+{1,14,18,31,1223,21},
+{1,14,18,31,1244,29},
+{1,14,17,38,1273,23},
+{3,14,17,31,1296,12},
+{2,7,15,38,1308,13},
+{8,4,11,38,1321,1},
+{3,7,16,38,1322,13},
+{1,18,18,25,1335,11},
+};
+const GlyphSpan spans[] = {
+{7,7,10,25},{8,27,10,28},{7,28,11,30},{8,30,10,31},{4,7,8,15},{11,7,15,15},{6,9,8,15},{12,9,15,15},{2,15,18,17},{5,17,8,20},
+{11,17,14,23},{5,20,7,23},{1,23,17,25},{5,25,7,26},{11,25,14,26},{4,26,7,31},{10,26,13,31},{10,6,12,8},{9,8,12,9},{6,9,14,10},
+{4,10,15,11},{3,11,7,12},{9,11,11,16},{14,11,15,12},{3,12,6,13},{2,13,5,16},{2,16,6,17},{8,16,11,18},{3,17,7,18},{4,18,11,19},
+{5,19,12,20},{7,20,14,21},{8,21,16,22},{8,22,10,24},{12,22,16,23},{13,23,17,24},{7,24,10,27},{14,24,17,27},{7,27,9,29},{13,27,16,28},
+{2,28,4,29},{12,28,16,29},{2,29,14,30},{4,30,12,31},{6,31,9,35},{3,7,8,8},{16,7,18,8},{2,8,9,9},{15,8,18,9},{2,9,5,10},
+{6,9,10,10},{14,9,17,10},{1,10,4,14},{7,10,10,14},{14,10,16,11},{13,11,16,12},{12,12,15,13},{12,13,14,14},{1,14,5,15},{6,14,9,15},
+{11,14,14,15},{2,15,9,16},{10,15,13,16},{3,16,8,17},{10,16,12,17},{9,17,12,18},{8,18,11,19},{8,19,10,20},{7,20,10,21},{6,21,9,22},
+{11,21,16,22},{6,22,8,23},{10,22,17,23},{5,23,8,24},{10,23,13,24},{14,23,18,24},{4,24,7,25},{9,24,12,28},{15,24,18,28},{4,25,6,26},
+{3,26,6,27},{2,27,5,28},{2,28,4,29},{9,28,13,29},{14,28,17,29},{1,29,4,30},{10,29,17,30},{0,30,3,31},{11,30,16,31},{6,7,11,8},
+{5,8,13,9},{4,9,7,10},{10,9,13,10},{3,10,6,14},{11,10,14,14},{3,14,7,15},{10,14,13,15},{4,15,7,16},{9,15,13,16},{4,16,12,17},
+{5,17,10,18},{4,18,9,19},{3,19,10,20},{14,19,17,23},{2,20,6,21},{7,20,10,21},{2,21,5,22},{8,21,11,22},{1,22,4,27},{9,22,12,23},
+{9,23,13,24},{14,23,16,24},{10,24,16,25},{11,25,16,26},{12,26,15,27},{2,27,5,28},{12,27,16,28},{2,28,6,29},{11,28,17,29},{3,29,13,30},
+{14,29,18,30},{5,30,11,31},{15,30,19,31},{8,7,12,15},{12,6,13,7},{11,7,14,8},{10,8,13,9},{9,9,12,11},{8,11,11,12},{7,12,10,14},
+{6,14,9,18},{5,18,8,26},{5,26,9,27},{6,27,9,29},{6,29,10,30},{7,30,10,31},{7,31,11,32},{8,32,11,33},{9,33,12,34},{9,34,13,35},
+{10,35,13,36},{11,36,14,37},{12,37,13,38},{6,6,7,7},{5,7,8,8},{6,8,9,9},{6,9,10,10},{7,10,10,11},{8,11,11,12},{8,12,12,13},
+{9,13,12,14},{9,14,13,15},{10,15,13,17},{10,17,14,18},{11,18,14,26},{11,26,13,27},{10,27,13,30},{9,30,12,32},{8,32,11,33},{7,33,10,35},
+{6,35,9,36},{5,36,8,37},{6,37,7,38},{8,7,10,12},{4,9,5,10},{13,9,14,10},{3,10,6,11},{12,10,15,11},{4,11,7,12},{11,11,14,12},
+{6,12,12,13},{8,13,10,14},{6,14,12,15},{4,15,14,16},{3,16,6,17},{8,16,10,21},{12,16,15,17},{4,17,5,18},{13,17,14,18},{8,14,11,21},
+{1,21,18,23},{8,23,11,30},{8,26,11,27},{7,27,11,28},{7,28,12,29},{8,29,12,31},{9,31,12,32},{8,32,12,33},{8,33,11,34},{7,34,10,35},
+{4,35,9,36},{4,36,7,37},{4,21,14,23},{7,25,11,26},{6,26,12,30},{7,30,11,31},{13,7,16,8},{12,8,15,10},{12,10,14,11},{11,11,14,13},
+{10,13,13,15},{10,15,12,16},{9,16,12,18},{8,18,11,20},{8,20,10,21},{7,21,10,23},{7,23,9,24},{6,24,9,25},{6,25,8,26},{5,26,8,28},
+{5,28,7,29},{4,29,7,31},{3,31,6,33},{3,33,5,34},{2,34,5,35},{6,9,12,10},{4,10,14,11},{3,11,7,12},{11,11,15,12},{3,12,6,13},
+{12,12,15,13},{2,13,5,15},{13,13,16,15},{2,15,4,16},{13,15,17,16},{1,16,4,23},{12,16,17,17},{10,17,13,18},{14,17,17,24},{9,18,12,19},
+{8,19,11,20},{7,20,10,21},{6,21,9,22},{5,22,8,23},{1,23,6,24},{1,24,5,25},{14,24,16,25},{2,25,5,27},{13,25,16,27},{3,27,6,28},
+{12,27,15,28},{3,28,7,29},{11,28,15,29},{4,29,14,30},{6,30,12,31},{9,9,12,10},{7,10,12,11},{5,11,8,12},{9,11,12,29},{3,12,7,13},
+{2,13,5,14},{3,14,4,15},{3,29,17,31},{5,9,11,10},{3,10,13,11},{2,11,6,12},{10,11,14,12},{3,12,4,13},{11,12,14,13},{12,13,15,18},
+{11,18,15,19},{11,19,14,20},{10,20,14,21},{9,21,13,22},{8,22,12,23},{7,23,11,24},{6,24,10,25},{5,25,9,26},{4,26,8,27},{4,27,7,28},
+{3,28,6,29},{2,29,16,31},{5,9,12,10},{4,10,14,11},{4,11,6,12},{11,11,15,12},{12,12,16,13},{13,13,16,17},{12,17,15,18},{11,18,14,19},
+{6,19,13,20},{6,20,15,21},{12,21,16,22},{13,22,17,23},{14,23,17,27},{13,27,16,28},{11,28,15,29},{3,29,14,30},{3,30,12,31},{10,9,14,10},
+{9,10,14,11},{8,11,14,13},{7,13,10,14},{11,13,14,24},{7,14,9,15},{6,15,9,16},{5,16,8,18},{4,18,7,20},{3,20,6,21},{2,21,5,23},
+{1,23,4,24},{1,24,18,26},{11,26,14,31},{3,9,15,11},{3,11,6,18},{3,18,12,19},{3,19,14,20},{11,20,15,21},{12,21,16,22},{13,22,16,26},
+{12,26,15,28},{10,28,14,29},{3,29,13,30},{3,30,11,31},{9,9,15,10},{7,10,15,11},{5,11,9,12},{4,12,8,13},{4,13,7,14},{3,14,6,16},
+{3,16,5,17},{2,17,5,18},{6,17,13,18},{2,18,15,19},{2,19,6,20},{12,19,16,20},{2,20,5,25},{13,20,16,21},{14,21,17,26},{2,25,6,26},
+{3,26,6,28},{13,26,16,28},{4,28,8,29},{12,28,15,29},{5,29,14,30},{6,30,12,31},{2,9,17,11},{14,11,17,12},{13,12,16,14},{12,14,15,16},
+{11,16,14,18},{10,18,14,19},{10,19,13,20},{9,20,13,21},{9,21,12,22},{8,22,12,23},{8,23,11,25},{7,25,10,27},{6,27,9,29},{5,29,8,31},
+{6,9,13,10},{4,10,15,11},{3,11,7,12},{12,11,16,12},{2,12,5,16},{14,12,17,16},{2,16,6,17},{13,16,17,17},{3,17,7,18},{12,17,16,18},
+{4,18,9,19},{11,18,15,19},{5,19,13,20},{6,20,14,21},{4,21,8,22},{10,21,15,22},{3,22,7,23},{12,22,16,23},{3,23,6,24},{13,23,17,24},
+{2,24,5,27},{14,24,17,27},{2,27,6,28},{13,27,17,28},{3,28,7,29},{12,28,16,29},{4,29,15,30},{6,30,13,31},{7,9,12,10},{5,10,14,11},
+{4,11,7,12},{11,11,15,12},{3,12,6,14},{12,12,16,13},{13,13,16,15},{2,14,5,19},{14,15,17,20},{3,19,6,20},{3,20,7,21},{13,20,17,21},
+{4,21,17,22},{6,22,13,23},{14,22,17,23},{14,23,16,24},{13,24,16,26},{12,26,15,27},{11,27,15,28},{9,28,14,29},{3,29,12,30},{3,30,9,31},
+{8,14,11,15},{7,15,12,18},{8,18,11,19},{8,26,11,27},{7,27,12,30},{8,30,11,31},{8,14,11,15},{7,15,12,18},{8,18,11,19},{8,26,11,27},
+{7,27,11,28},{7,28,12,29},{8,29,12,31},{9,31,12,32},{8,32,12,33},{8,33,11,34},{7,34,10,35},{4,35,9,36},{4,36,7,37},{13,12,14,13},
+{11,13,15,14},{10,14,14,15},{9,15,13,16},{8,16,12,17},{7,17,11,18},{6,18,10,19},{4,19,8,20},{3,20,7,21},{2,21,6,22},{3,22,7,23},
+{4,23,8,24},{6,24,10,25},{7,25,11,26},{8,26,12,27},{9,27,13,28},{10,28,14,29},{11,29,15,30},{13,30,14,31},{2,18,16,20},{2,23,16,25},
+{4,12,5,13},{3,13,7,14},{4,14,8,15},{5,15,9,16},{6,16,10,17},{7,17,11,18},{8,18,12,19},{10,19,14,20},{11,20,15,21},{12,21,16,22},
+{11,22,15,23},{10,23,14,24},{8,24,12,25},{7,25,11,26},{6,26,10,27},{5,27,9,28},{4,28,8,29},{3,29,7,30},{4,30,5,31},{5,7,9,8},
+{5,8,11,9},{8,9,13,10},{10,10,14,11},{11,11,14,12},{12,12,15,17},{11,17,14,18},{7,18,14,19},{7,19,12,20},{7,20,10,25},{7,27,9,28},
+{6,28,10,30},{7,30,9,31},{8,7,13,8},{6,8,15,9},{5,9,8,10},{13,9,16,10},{4,10,7,11},{14,10,16,11},{3,11,6,12},{15,11,17,14},
+{3,12,5,13},{2,13,5,14},{2,14,4,15},{16,14,18,25},{1,15,4,16},{8,15,14,16},{1,16,3,19},{6,16,14,17},{6,17,9,18},{11,17,14,20},
+{5,18,8,20},{0,19,3,20},{0,20,2,30},{5,20,7,21},{11,20,13,24},{4,21,7,28},{10,24,13,27},{15,25,17,28},{9,27,13,28},{5,28,10,29},
+{11,28,16,29},{6,29,9,30},{12,29,15,30},{0,30,3,31},{1,31,3,33},{1,33,4,34},{2,34,5,35},{2,35,6,36},{12,35,14,36},{3,36,14,37},
+{5,37,12,38},{7,9,12,11},{7,11,9,12},{10,11,12,12},{6,12,9,14},{10,12,13,15},{6,14,8,15},{5,15,8,18},{11,15,14,18},{5,18,7,19},
+{12,18,15,21},{4,19,7,21},{4,21,6,22},{13,21,16,24},{3,22,6,24},{3,24,16,25},{2,25,17,26},{2,26,5,28},{14,26,17,28},{1,28,4,31},
+{15,28,18,31},{3,9,13,10},{3,10,14,11},{3,11,6,19},{11,11,15,12},{12,12,16,13},{13,13,16,17},{12,17,15,18},{11,18,15,19},{3,19,13,20},
+{3,20,15,21},{3,21,6,29},{12,21,16,22},{13,22,17,23},{14,23,17,27},{13,27,16,28},{12,28,16,29},{3,29,14,30},{3,30,12,31},{8,9,16,10},
+{6,10,17,11},{5,11,9,12},{16,11,17,12},{4,12,8,13},{4,13,7,14},{3,14,6,16},{2,16,5,24},{2,24,6,25},{3,25,6,26},{3,26,7,27},
+{4,27,7,28},{5,28,9,29},{15,28,17,29},{6,29,17,30},{8,30,15,31},{2,9,12,10},{2,10,14,11},{2,11,5,29},{11,11,15,12},{13,12,16,13},
+{14,13,17,15},{14,15,18,16},{15,16,18,24},{14,24,17,26},{13,26,16,27},{12,27,16,28},{10,28,15,29},{2,29,13,30},{2,30,11,31},{3,9,15,11},
+{3,11,6,19},{3,19,15,21},{3,21,6,29},{3,29,15,31},{3,9,15,11},{3,11,6,19},{3,19,15,21},{3,21,6,31},{8,9,16,10},{6,10,17,11},
+{4,11,9,12},{15,11,17,12},{3,12,7,13},{3,13,6,14},{2,14,5,16},{1,16,4,24},{9,19,17,21},{14,21,17,29},{2,24,5,26},{2,26,6,27},
+{3,27,7,28},{4,28,8,29},{5,29,17,30},{7,30,15,31},{2,9,5,19},{14,9,17,19},{2,19,17,21},{2,21,5,31},{14,21,17,31},{3,9,16,11},
+{8,11,11,29},{3,29,16,31},{3,9,15,11},{12,11,15,27},{3,27,4,28},{11,27,14,28},{3,28,6,29},{10,28,14,29},{4,29,13,30},{5,30,11,31},
+{3,9,6,19},{14,9,17,10},{13,10,16,11},{12,11,15,12},{11,12,15,13},{11,13,14,14},{10,14,13,15},{9,15,12,16},{8,16,11,18},{7,18,10,19},
+{3,19,9,20},{3,20,10,21},{3,21,6,31},{7,21,10,22},{8,22,11,23},{8,23,12,24},{9,24,13,25},{10,25,13,26},{11,26,14,27},{11,27,15,28},
+{12,28,16,29},{13,29,17,30},{14,30,17,31},{4,9,7,29},{4,29,16,31},{1,9,5,11},{13,9,17,12},{1,11,6,13},{12,12,14,15},{15,12,17,17},
+{1,13,7,15},{1,15,4,31},{5,15,7,16},{11,15,13,18},{5,16,8,17},{6,17,8,18},{15,17,18,31},{6,18,9,19},{10,18,12,21},{7,19,9,21},
+{7,21,11,22},{8,22,11,24},{2,9,6,10},{14,9,17,27},{2,10,7,12},{2,12,8,13},{2,13,5,31},{6,13,8,15},{6,15,9,16},{7,16,9,17},
+{7,17,10,18},{8,18,10,19},{8,19,11,21},{9,21,11,22},{9,22,12,23},{10,23,12,24},{10,24,13,25},{11,25,13,27},{11,27,17,28},{12,28,17,30},
+{13,30,17,31},{7,9,13,10},{5,10,15,11},{4,11,7,12},{12,11,16,12},{3,12,6,13},{13,12,16,13},{2,13,5,16},{14,13,17,15},{15,15,18,24},
+{1,16,4,24},{1,24,5,25},{14,24,17,27},{2,25,5,27},{3,27,6,28},{13,27,16,28},{3,28,7,29},{12,28,15,29},{4,29,14,30},{6,30,12,31},
+{3,9,13,10},{3,10,15,11},{3,11,6,21},{12,11,16,12},{13,12,16,13},{14,13,17,18},{13,18,16,20},{11,20,15,21},{3,21,14,22},{3,22,12,23},
+{3,23,6,31},{7,9,13,10},{5,10,15,11},{4,11,7,12},{12,11,16,12},{3,12,6,13},{13,12,16,13},{2,13,5,16},{14,13,17,15},{15,15,18,24},
+{1,16,4,24},{1,24,5,25},{14,24,17,27},{2,25,5,27},{3,27,6,28},{13,27,16,28},{3,28,7,29},{12,28,15,29},{4,29,14,30},{6,30,13,31},
+{8,31,11,33},{9,33,12,34},{9,34,13,35},{17,34,18,35},{10,35,19,36},{12,36,18,37},{3,9,12,10},{3,10,14,11},{3,11,6,19},{11,11,15,12},
+{12,12,16,13},{13,13,16,17},{12,17,15,18},{11,18,15,19},{3,19,14,20},{3,20,12,21},{3,21,6,31},{9,21,13,22},{10,22,13,23},{11,23,14,25},
+{12,25,15,26},{12,26,16,27},{13,27,16,28},{13,28,17,29},{14,29,17,30},{14,30,18,31},{6,9,13,10},{4,10,15,11},{3,11,7,12},{13,11,15,12},
+{3,12,6,13},{2,13,5,16},{2,16,6,17},{3,17,7,18},{4,18,9,19},{5,19,12,20},{7,20,14,21},{9,21,15,22},{11,22,15,23},{12,23,16,24},
+{13,24,16,27},{12,27,15,28},{2,28,4,29},{11,28,15,29},{2,29,14,30},{4,30,12,31},{2,9,17,11},{8,11,11,31},{2,9,5,27},{14,9,17,26},
+{14,26,16,27},{3,27,6,28},{13,27,16,28},{3,28,7,29},{12,28,15,29},{4,29,14,30},{6,30,12,31},{1,9,4,11},{15,9,18,12},{1,11,5,12},
+{2,12,5,15},{14,12,17,15},{3,15,6,18},{13,15,16,18},{3,18,7,19},{12,18,15,21},{4,19,7,21},{4,21,8,22},{12,21,14,22},{5,22,8,25},
+{11,22,14,24},{11,24,13,25},{6,25,9,28},{10,25,13,27},{10,27,12,28},{7,28,12,31},{2,9,5,24},{15,9,18,24},{9,16,11,17},{8,17,11,19},
+{8,19,12,20},{8,20,9,21},{10,20,12,22},{7,21,9,25},{10,22,13,23},{11,23,13,25},{3,24,5,27},{15,24,17,27},{6,25,8,27},{11,25,14,26},
+{12,26,14,27},{3,27,8,29},{12,27,17,29},{3,29,7,31},{13,29,17,31},{1,9,5,10},{14,9,18,10},{2,10,5,11},{14,10,17,11},{3,11,6,12},
+{13,11,16,12},{3,12,7,13},{12,12,16,13},{4,13,7,14},{12,13,15,14},{5,14,8,15},{11,14,14,15},{5,15,9,16},{10,15,14,16},{6,16,9,17},
+{10,16,13,17},{7,17,12,19},{8,19,11,20},{7,20,12,21},{6,21,13,22},{6,22,9,23},{10,22,13,23},{5,23,9,24},{10,23,14,24},{4,24,8,25},
+{11,24,15,25},{4,25,7,26},{12,25,15,26},{3,26,7,27},{12,26,16,27},{2,27,6,28},{13,27,17,28},{2,28,5,29},{14,28,17,29},{1,29,5,30},
+{14,29,18,30},{0,30,4,31},{15,30,19,31},{0,9,3,10},{16,9,19,10},{1,10,4,11},{15,10,18,12},{1,11,5,12},{2,12,5,13},{14,12,17,13},
+{3,13,6,15},{13,13,16,15},{4,15,7,16},{12,15,15,17},{4,16,8,17},{5,17,8,18},{11,17,14,19},{5,18,9,19},{6,19,9,20},{10,19,13,20},
+{7,20,12,22},{8,22,11,31},{2,9,17,11},{13,11,16,12},{12,12,16,13},{12,13,15,14},{11,14,14,16},{10,16,13,17},{9,17,13,18},{9,18,12,19},
+{8,19,11,21},{7,21,10,23},{6,23,9,24},{5,24,8,26},{4,26,7,28},{3,28,6,29},{2,29,17,31},{5,7,13,9},{5,9,8,36},{5,36,13,38},
+{3,7,6,8},{4,8,6,9},{4,9,7,11},{5,11,8,13},{6,13,8,14},{6,14,9,16},{7,16,9,17},{7,17,10,18},{8,18,10,19},{8,19,11,21},
+{9,21,11,22},{9,22,12,24},{10,24,13,26},{11,26,13,27},{11,27,14,29},{12,29,15,31},{13,31,15,32},{13,32,16,34},{14,34,17,35},{5,7,13,9},
+{10,9,13,36},{5,36,13,38},{8,9,11,10},{8,10,12,11},{7,11,9,13},{10,11,12,12},{10,12,13,13},{6,13,9,14},{11,13,14,15},{5,14,8,16},
+{12,15,15,17},{4,16,7,18},{13,17,16,18},{3,18,6,20},{14,18,17,20},{0,36,19,38},{4,7,8,8},{5,8,9,9},{6,9,10,10},{7,10,11,11},
+{5,14,13,15},{3,15,14,16},{3,16,5,17},{11,16,15,17},{12,17,16,18},{13,18,16,21},{6,21,16,22},{4,22,16,23},{3,23,7,24},{13,23,16,27},
+{2,24,5,28},{12,27,16,28},{2,28,6,29},{10,28,16,29},{3,29,12,30},{13,29,16,31},{5,30,10,31},{3,7,6,16},{9,14,14,15},{7,15,15,16},
+{3,16,9,17},{12,16,16,17},{3,17,8,18},{13,17,16,18},{3,18,7,19},{14,18,17,26},{3,19,6,28},{13,26,16,28},{3,28,7,29},{11,28,15,29},
+{3,29,14,30},{5,30,12,31},{8,14,15,15},{6,15,16,16},{5,16,9,17},{15,16,16,17},{4,17,8,18},{4,18,7,19},{3,19,7,20},{3,20,6,26},
+{4,26,7,27},{4,27,8,28},{5,28,9,29},{15,28,16,29},{6,29,16,30},{8,30,15,31},{13,7,16,14},{7,14,16,15},{5,15,16,16},{4,16,8,17},
+{13,16,16,26},{3,17,6,19},{2,19,5,27},{12,26,16,27},{3,27,6,28},{11,27,16,28},{3,28,7,29},{10,28,16,29},{4,29,12,30},{13,29,16,31},
+{5,30,10,31},{7,14,13,15},{5,15,14,16},{4,16,8,17},{12,16,15,17},{3,17,6,19},{13,17,16,19},{2,19,5,22},{14,19,17,22},{2,22,17,24},
+{2,24,5,26},{3,26,6,28},{4,28,8,29},{14,28,16,29},{5,29,16,30},{7,30,14,31},{11,7,18,8},{9,8,18,9},{8,9,12,10},{8,10,11,11},
+{7,11,10,17},{1,17,17,19},{7,19,10,31},{7,14,19,15},{5,15,19,16},{4,16,8,17},{12,16,16,17},{4,17,7,18},{13,17,17,18},{3,18,6,22},
+{14,18,17,22},{4,22,7,23},{13,22,16,23},{4,23,8,24},{12,23,16,24},{4,24,15,25},{3,25,6,28},{7,25,13,26},{3,28,7,29},{4,29,15,30},
+{4,30,17,31},{3,31,6,32},{14,31,18,32},{2,32,5,35},{15,32,18,35},{2,35,6,36},{13,35,17,36},{3,36,16,37},{5,37,14,38},{3,7,6,16},
+{9,14,14,15},{7,15,16,16},{3,16,9,17},{13,16,16,17},{3,17,8,18},{14,17,17,31},{3,18,7,19},{3,19,6,31},{8,8,11,9},{7,9,12,11},
+{8,11,11,12},{4,14,11,16},{8,16,11,29},{3,29,16,31},{11,8,14,9},{10,9,15,11},{11,11,14,12},{3,14,14,16},{11,16,14,34},{10,34,13,35},
+{2,35,3,36},{9,35,13,36},{2,36,12,37},{3,37,10,38},{3,7,6,21},{13,14,17,15},{12,15,16,16},{11,16,15,17},{10,17,14,18},{9,18,13,19},
+{8,19,12,20},{7,20,11,21},{3,21,9,22},{3,22,6,31},{7,22,10,23},{7,23,11,24},{8,24,12,25},{9,25,13,26},{10,26,14,27},{11,27,15,28},
+{12,28,16,29},{13,29,17,30},{14,30,18,31},{4,7,11,9},{8,9,11,29},{3,29,16,31},{1,14,4,16},{6,14,9,15},{13,14,16,15},{5,15,10,16},
+{12,15,17,16},{1,16,6,17},{8,16,10,17},{11,16,13,17},{15,16,18,31},{1,17,5,19},{8,17,12,19},{1,19,4,31},{8,19,11,31},{3,14,6,16},
+{9,14,14,15},{7,15,16,16},{3,16,9,17},{13,16,16,17},{3,17,8,18},{14,17,17,31},{3,18,7,19},{3,19,6,31},{7,14,13,15},{5,15,15,16},
+{4,16,8,17},{12,16,16,17},{3,17,7,18},{14,17,17,19},{3,18,6,19},{2,19,5,26},{15,19,18,26},{3,26,6,28},{14,26,17,27},{13,27,17,28},
+{4,28,8,29},{12,28,16,29},{5,29,15,30},{7,30,13,31},{3,14,6,16},{9,14,14,15},{7,15,15,16},{3,16,9,17},{12,16,16,17},{3,17,8,18},
+{13,17,16,18},{3,18,7,19},{14,18,17,26},{3,19,6,28},{13,26,16,28},{3,28,7,29},{11,28,15,29},{3,29,14,30},{3,30,12,31},{3,31,6,38},
+{7,14,13,15},{14,14,16,15},{5,15,16,16},{4,16,8,17},{12,16,16,17},{3,17,6,19},{13,17,16,26},{2,19,5,27},{12,26,16,27},{3,27,6,28},
+{11,27,16,28},{3,28,7,29},{10,28,16,29},{4,29,12,30},{13,29,16,38},{5,30,10,31},{3,14,6,16},{9,14,14,15},{7,15,16,16},{3,16,9,17},
+{13,16,16,17},{3,17,8,18},{14,17,17,20},{3,18,7,19},{3,19,6,31},{7,14,14,15},{5,15,15,16},{4,16,7,17},{13,16,15,17},{3,17,6,20},
+{3,20,8,21},{4,21,11,22},{6,22,14,23},{8,23,15,24},{11,24,16,25},{13,25,16,28},{3,28,5,29},{12,28,15,29},{3,29,14,30},{5,30,12,31},
+{7,9,9,10},{6,10,9,14},{1,14,16,16},{6,16,9,28},{6,28,10,29},{15,28,16,29},{7,29,16,30},{9,30,15,31},{3,14,6,28},{14,14,17,26},
+{13,26,17,27},{12,27,17,28},{4,28,7,29},{11,28,17,29},{4,29,13,30},{14,29,17,31},{6,30,11,31},{2,14,5,16},{14,14,17,16},{2,16,6,17},
+{13,16,17,17},{3,17,6,19},{13,17,16,19},{4,19,7,22},{12,19,15,22},{5,22,8,25},{11,22,14,25},{6,25,9,28},{10,25,13,27},{10,27,12,29},
+{7,28,9,29},{7,29,12,30},{8,30,11,31},{1,14,3,15},{16,14,18,16},{1,15,4,20},{15,16,18,22},{8,18,11,20},{2,20,4,21},{8,20,12,22},
+{2,21,5,26},{7,22,9,25},{10,22,12,23},{15,22,17,28},{10,23,13,24},{11,24,13,26},{6,25,8,28},{3,26,5,28},{11,26,14,27},{12,27,14,28},
+{3,28,8,29},{12,28,17,30},{3,29,7,31},{13,30,17,31},{1,14,5,15},{13,14,17,15},{2,15,6,16},{12,15,16,16},{3,16,7,17},{12,16,15,17},
+{4,17,7,18},{11,17,14,18},{4,18,8,19},{10,18,14,19},{5,19,9,20},{10,19,13,20},{6,20,12,21},{7,21,12,22},{7,22,11,23},{6,23,12,24},
+{6,24,13,25},{5,25,8,26},{10,25,14,26},{4,26,8,27},{11,26,14,27},{4,27,7,28},{12,27,15,28},{3,28,6,29},{12,28,16,29},{2,29,6,30},
+{13,29,17,30},{1,30,5,31},{14,30,18,31},{2,14,5,16},{14,14,17,16},{2,16,6,17},{13,16,17,17},{3,17,6,19},{13,17,16,19},{4,19,7,22},
+{12,19,15,22},{5,22,8,25},{11,22,14,24},{11,24,13,25},{6,25,9,27},{10,25,13,27},{7,27,9,28},{10,27,12,28},{7,28,12,29},{7,29,11,30},
+{8,30,11,32},{7,32,10,34},{6,34,9,35},{5,35,8,36},{1,36,7,37},{1,37,6,38},{3,14,16,16},{12,16,15,17},{11,17,15,18},{11,18,14,19},
+{10,19,13,20},{9,20,12,22},{8,22,11,23},{7,23,10,25},{6,25,9,26},{5,26,8,28},{4,28,7,29},{3,29,17,31},{10,7,15,8},{9,8,15,9},
+{8,9,12,10},{7,10,11,11},{7,11,10,20},{6,20,9,21},{2,21,8,23},{6,23,9,24},{7,24,10,34},{7,34,11,35},{8,35,12,36},{9,36,15,37},
+{10,37,15,38},{8,4,11,38},{3,7,8,8},{3,8,9,9},{6,9,10,10},{7,10,11,11},{8,11,11,20},{9,20,13,21},{10,21,16,23},{9,23,12,24},
+{8,24,11,34},{7,34,11,35},{6,35,10,36},{3,36,9,37},{3,37,8,38},{4,18,8,19},{2,19,9,20},{15,19,18,22},{2,20,5,21},{7,20,10,21},
+{1,21,4,24},{8,21,11,22},{9,22,12,23},{14,22,17,23},{10,23,17,24},{11,24,15,25},
+};
+const Font font = { 20, 40, 32, 126, glyphs, spans };
+}
+
+namespace spans48 {
+const Glyph glyphs[] = {
+{0,0,0,0,0,0},
+{9,10,14,38,0,6},
+{5,10,18,19,6,4},
+{1,12,22,38,10,15},
+{2,8,20,43,25,31},
+{0,10,22,38,56,52},
+{1,10,22,38,108,39},
+{9,10,14,19,147,2},
+{7,8,18,46,149,23},
+{5,8,16,46,172,23},
+{3,10,20,27,195,19},
+{2,18,21,37,214,3},
+{5,32,14,45,217,10},
+{5,26,17,29,227,1},
+{8,31,15,38,228,5},
+{2,10,19,42,233,24},
+{2,12,21,38,257,35},
+{2,12,20,38,292,9},
+{3,12,20,38,301,21},
+{3,12,19,38,322,20},
+{1,12,22,38,342,19},
+{4,12,20,38,361,15},
+{2,12,19,38,376,28},
+{2,12,20,38,404,21},
+{2,12,20,38,425,31},
+{2,12,19,38,456,27},
+{8,18,14,38,483,6},
+{5,18,14,45,489,13},
+{4,16,19,38,502,21},
+{3,22,20,32,523,2},
+{4,16,19,38,525,21},
+{6,10,19,38,546,17},
+{0,10,22,46,563,40},
+{1,12,22,38,603,29},
+{3,12,19,38,632,20},
+{2,12,20,38,652,20},
+{2,12,21,38,672,17},
+{4,12,19,38,689,5},
+{4,12,19,38,694,4},
+{1,12,19,38,698,21},
+{2,12,20,38,719,5},
+{3,12,18,38,724,3},
+{4,12,17,38,727,9},
+{3,12,20,38,736,26},
+{5,12,20,38,762,2},
+{1,12,22,38,764,26},
+{2,12,20,38,790,20},
+{1,12,21,38,810,27},
+{3,12,20,38,837,15},
+{1,12,23,45,852,31},
+{3,12,21,38,883,21},
+{3,12,21,38,904,23},
+{1,12,20,38,927,2},
+{2,12,20,38,929,11},
+{1,12,22,38,940,29},
+{2,12,22,38,969,22},
+{0,12,23,38,991,40},
+{1,12,22,38,1031,20},
+{2,12,21,38,1051,21},
+{7,9,17,46,1072,3},
+{3,10,20,42,1075,24},
+{5,9,15,46,1099,3},
+{3,12,20,25,1102,15},
+{0,43,23,46,1117,1},
+{4,10,12,15,1118,5},
+{3,18,19,38,1123,21},
+{3,10,20,38,1144,18},
+{3,18,19,38,1162,17},
+{2,10,19,38,1179,20},
+{2,18,19,38,1199,19},
+{2,10,21,38,1218,9},
+{2,18,21,46,1227,31},
+{3,10,19,38,1258,11},
+{3,10,19,38,1269,6},
+{2,10,17,46,1275,12},
+{4,10,21,38,1287,22},
+{3,10,19,38,1309,3},
+{2,18,21,38,1312,16},
+{3,18,19,38,1328,11},
+{2,18,20,38,1339,24},
+{3,18,20,46,1363,19},
+{2,18,19,46,1382,20},
+{4,18,20,38,1402,12},
+{4,18,19,38,1414,18},
+{1,12,19,38,1432,9},
+{3,18,19,38,1441,11},
+{2,18,21,38,1452,24},
+{2,18,22,38,1476,24},
+{1,18,22,38,1500,32},
+{1,18,21,46,1532,32},
+{3,18,20,38,1564,16},
+{3,9,18,46,1580,19},
+{10,5,13,46,1599,1},
+{5,9,20,46,1600,19},
+{1,23,21,31,1619,12},
+};
+const GlyphSpan spans[] = {
+{10,10,14,28},{11,28,14,29},{11,29,13,30},{10,33,13,34},{9,34,14,37},{10,37,13,38},{5,10,10,17},{13,10,18,17},{6,17,9,19},{14,17,17,19},
+{8,12,11,17},{15,12,18,16},{15,16,17,17},{7,17,10,19},{14,17,17,19},{2,19,22,22},{7,22,10,25},{14,22,17,25},{6,25,9,28},{13,25,16,28},
+{1,28,21,31},{6,31,9,34},{13,31,16,34},{5,34,8,38},{12,34,15,38},{12,8,14,9},{11,9,14,12},{8,12,16,13},{5,13,18,14},{4,14,18,15},
+{3,15,8,16},{11,15,13,16},{16,15,18,16},{3,16,7,17},{10,16,13,22},{2,17,6,20},{2,20,7,21},{3,21,8,22},{3,22,13,23},{4,23,12,24},
+{6,24,15,25},{8,25,17,26},{9,26,18,27},{9,27,12,31},{13,27,19,28},{15,28,20,29},{16,29,20,33},{8,31,11,35},{15,33,19,34},{2,34,4,35},
+{13,34,19,35},{2,35,18,36},{2,36,17,37},{4,37,14,38},{8,38,10,39},{7,39,10,43},{4,10,9,11},{19,10,22,11},{3,11,11,12},{18,11,21,12},
+{2,12,11,13},{17,12,21,13},{1,13,5,14},{8,13,12,14},{17,13,20,14},{1,14,4,18},{9,14,12,18},{16,14,19,15},{15,15,19,16},{15,16,18,17},
+{14,17,17,18},{1,18,5,19},{8,18,12,19},{13,18,17,19},{2,19,11,20},{13,19,16,20},{2,20,10,21},{12,20,15,21},{4,21,9,22},{11,21,15,22},
+{11,22,14,23},{10,23,13,24},{9,24,12,25},{8,25,12,26},{8,26,11,27},{14,26,19,27},{7,27,10,28},{13,27,21,28},{6,28,10,29},{12,28,21,29},
+{6,29,9,30},{11,29,15,30},{18,29,22,30},{5,30,8,31},{11,30,14,34},{19,30,22,34},{4,31,8,32},{4,32,7,33},{3,33,6,34},{2,34,6,35},
+{11,34,15,35},{18,34,22,35},{2,35,5,36},{12,35,21,36},{1,36,4,37},{12,36,20,37},{0,37,4,38},{14,37,19,38},{7,10,13,11},{5,11,14,12},
+{4,12,15,13},{4,13,8,14},{12,13,16,14},{3,14,6,18},{13,14,16,18},{3,18,7,19},{12,18,15,19},{4,19,7,20},{11,19,15,20},{4,20,8,21},
+{10,20,14,21},{5,21,13,22},{5,22,12,23},{5,23,10,24},{4,24,11,25},{17,24,20,28},{3,25,7,26},{8,25,12,26},{2,26,6,27},{9,26,13,27},
+{2,27,5,28},{9,27,14,28},{1,28,4,33},{10,28,14,29},{16,28,19,30},{11,29,15,30},{12,30,19,31},{12,31,18,32},{13,32,18,34},{1,33,5,34},
+{2,34,7,35},{11,34,19,35},{3,35,20,36},{4,36,14,37},{16,36,21,37},{6,37,12,38},{17,37,22,38},{9,10,14,17},{10,17,13,19},{16,8,17,9},
+{15,9,17,10},{14,10,18,11},{13,11,17,12},{12,12,16,13},{11,13,15,14},{11,14,14,15},{10,15,13,17},{9,17,12,19},{8,19,11,22},{7,22,10,31},
+{7,31,11,32},{8,32,11,35},{9,35,12,37},{9,37,13,38},{10,38,14,39},{11,39,14,40},{11,40,15,41},{12,41,16,42},{13,42,17,43},{14,43,18,44},
+{14,44,17,45},{15,45,16,46},{7,8,8,9},{6,9,9,10},{5,10,9,11},{6,11,10,12},{7,12,11,13},{8,13,12,14},{9,14,12,15},{10,15,13,16},
+{10,16,14,17},{11,17,14,19},{12,19,15,22},{12,22,16,23},{13,23,16,32},{12,32,15,35},{11,35,14,37},{10,37,13,39},{9,39,12,40},{8,40,12,41},
+{7,41,11,42},{6,42,10,43},{5,43,9,44},{6,44,8,45},{6,45,7,46},{10,10,13,16},{4,13,5,14},{18,13,19,14},{4,14,7,15},{16,14,19,15},
+{3,15,8,16},{15,15,20,16},{5,16,18,17},{7,17,16,18},{9,18,14,19},{8,19,15,20},{5,20,18,21},{3,21,8,22},{10,21,13,27},{15,21,20,22},
+{3,22,7,23},{16,22,19,23},{4,23,5,24},{18,23,19,24},{10,18,13,26},{2,26,21,29},{10,29,13,37},{9,32,12,33},{8,33,13,34},{8,34,14,36},
+{9,36,14,37},{10,37,14,40},{9,40,13,41},{8,41,13,42},{5,42,12,43},{5,43,10,44},{5,44,8,45},{5,26,17,29},{10,31,13,32},{9,32,14,33},
+{8,33,15,36},{9,36,14,37},{10,37,13,38},{16,10,19,11},{15,11,19,12},{15,12,18,13},{14,13,18,14},{14,14,17,16},{13,16,16,18},{12,18,16,19},
+{12,19,15,20},{11,20,15,21},{11,21,14,23},{10,23,13,25},{9,25,13,26},{9,26,12,27},{8,27,12,28},{8,28,11,29},{7,29,11,30},{7,30,10,32},
+{6,32,9,34},{5,34,9,35},{5,35,8,36},{4,36,8,37},{4,37,7,39},{3,39,6,41},{2,41,6,42},{8,12,15,13},{7,13,17,14},{5,14,18,15},
+{4,15,9,16},{14,15,19,16},{4,16,8,17},{16,16,19,17},{3,17,7,18},{16,17,20,18},{3,18,6,20},{17,18,20,20},{2,20,6,21},{15,20,21,21},
+{2,21,5,28},{14,21,21,22},{12,22,17,23},{18,22,21,30},{11,23,16,24},{10,24,14,25},{8,25,13,26},{7,26,12,27},{6,27,10,28},{2,28,9,29},
+{2,29,8,30},{3,30,6,32},{17,30,20,32},{3,32,7,33},{16,32,20,33},{4,33,7,34},{15,33,19,34},{4,34,9,35},{14,34,19,35},{5,35,18,36},
+{6,36,16,37},{8,37,15,38},{10,12,14,13},{7,13,14,14},{5,14,14,15},{3,15,9,16},{10,15,14,35},{2,16,8,17},{3,17,6,18},{3,18,4,19},
+{3,35,20,38},{8,12,14,13},{6,13,16,14},{4,14,17,15},{3,15,8,16},{13,15,18,16},{4,16,6,17},{14,16,18,17},{15,17,19,23},{14,23,18,24},
+{13,24,18,25},{12,25,17,26},{12,26,16,27},{11,27,15,28},{10,28,14,29},{9,29,14,30},{8,30,13,31},{7,31,12,32},{6,32,11,33},{5,33,10,34},
+{4,34,9,35},{3,35,20,38},{6,12,14,13},{4,13,16,14},{4,14,17,15},{4,15,6,16},{13,15,17,16},{14,16,18,17},{15,17,18,21},{14,21,17,22},
+{12,22,16,23},{6,23,15,25},{6,25,17,26},{13,26,18,27},{15,27,18,28},{16,28,19,32},{15,32,19,33},{15,33,18,34},{13,34,17,35},{3,35,16,36},
+{3,36,15,37},{3,37,12,38},{12,12,17,14},{11,14,17,15},{10,15,17,16},{10,16,13,17},{14,16,17,29},{9,17,12,18},{8,18,12,19},{7,19,11,20},
+{7,20,10,21},{6,21,10,22},{5,22,9,23},{5,23,8,24},{4,24,8,25},{3,25,7,26},{3,26,6,27},{2,27,6,28},{1,28,5,29},{1,29,22,32},
+{14,32,17,38},{4,12,19,15},{4,15,7,22},{4,22,14,23},{4,23,17,24},{4,24,18,25},{13,25,19,26},{15,26,19,27},{16,27,20,32},{15,32,19,33},
+{14,33,19,34},{4,34,5,35},{12,34,18,35},{4,35,17,36},{4,36,15,37},{6,37,13,38},{10,12,17,13},{8,13,17,14},{6,14,17,15},{5,15,11,16},
+{4,16,8,17},{4,17,7,18},{3,18,6,20},{3,20,5,21},{2,21,5,24},{8,22,15,23},{6,23,16,24},{2,24,17,25},{2,25,8,26},{14,25,18,26},
+{2,26,6,27},{15,26,19,27},{2,27,5,31},{16,27,19,32},{2,31,6,32},{3,32,6,33},{15,32,19,33},{3,33,7,34},{15,33,18,34},{4,34,8,35},
+{13,34,18,35},{4,35,17,36},{5,36,16,37},{7,37,14,38},{2,12,20,15},{16,15,20,16},{16,16,19,17},{15,17,19,18},{15,18,18,19},{14,19,18,20},
+{14,20,17,21},{13,21,17,22},{13,22,16,23},{12,23,16,24},{12,24,15,25},{11,25,15,26},{11,26,14,27},{10,27,14,28},{10,28,13,29},{9,29,13,30},
+{9,30,12,31},{8,31,12,33},{7,33,11,35},{6,35,10,37},{5,37,9,38},{8,12,15,13},{6,13,17,14},{4,14,18,15},{4,15,8,16},{14,15,19,16},
+{3,16,6,20},{16,16,19,20},{3,20,7,21},{15,20,18,21},{4,21,8,22},{14,21,18,22},{5,22,10,23},{12,22,17,23},{6,23,16,24},{7,24,15,25},
+{6,25,16,26},{5,26,10,27},{12,26,18,27},{4,27,8,28},{14,27,19,28},{3,28,7,29},{15,28,19,29},{2,29,6,33},{16,29,20,33},{2,33,7,34},
+{15,33,20,34},{3,34,8,35},{14,34,19,35},{3,35,18,36},{5,36,17,37},{7,37,15,38},{7,12,14,13},{6,13,15,14},{4,14,16,15},{4,15,8,16},
+{13,15,17,16},{3,16,6,17},{14,16,18,17},{2,17,6,18},{15,17,18,19},{2,18,5,23},{16,19,19,23},{3,23,6,24},{15,23,19,24},{3,24,7,25},
+{13,24,19,25},{4,25,19,26},{5,26,15,27},{16,26,19,29},{7,27,13,28},{16,29,18,30},{15,30,18,32},{14,32,17,33},{13,33,17,34},{10,34,16,35},
+{4,35,15,36},{4,36,13,37},{4,37,10,38},{9,18,13,19},{8,19,14,23},{9,23,13,24},{9,32,13,33},{8,33,14,37},{9,37,13,38},{9,18,13,19},
+{8,19,14,23},{9,23,13,24},{9,32,12,33},{8,33,13,34},{8,34,14,36},{9,36,14,37},{10,37,14,40},{9,40,13,41},{8,41,13,42},{5,42,12,43},
+{5,43,10,44},{5,44,8,45},{16,16,17,17},{15,17,18,18},{14,18,19,19},{12,19,17,20},{11,20,16,21},{10,21,15,22},{9,22,14,23},{7,23,12,24},
+{6,24,11,25},{5,25,10,26},{4,26,9,28},{5,28,10,29},{6,29,11,30},{7,30,12,31},{9,31,14,32},{10,32,15,33},{11,33,16,34},{12,34,17,35},
+{14,35,19,36},{15,36,18,37},{16,37,17,38},{3,22,20,25},{3,29,20,32},{6,16,7,17},{5,17,8,18},{4,18,9,19},{6,19,11,20},{7,20,12,21},
+{8,21,13,22},{9,22,14,23},{11,23,16,24},{12,24,17,25},{13,25,18,26},{14,26,19,28},{13,28,18,29},{12,29,17,30},{11,30,16,31},{9,31,14,32},
+{8,32,13,33},{7,33,12,34},{6,34,11,35},{4,35,9,36},{5,36,8,37},{6,37,7,38},{6,10,11,11},{6,11,14,12},{6,12,15,13},{10,13,17,14},
+{12,14,17,15},{14,15,18,16},{14,16,19,17},{15,17,19,21},{14,21,19,22},{13,22,18,23},{8,23,18,24},{8,24,16,25},{8,25,14,26},{8,26,11,30},
+{8,33,11,34},{7,34,12,37},{8,37,11,38},{10,10,16,11},{8,11,18,12},{6,12,10,13},{15,12,19,13},{5,13,9,14},{16,13,20,14},{5,14,8,15},
+{17,14,20,15},{4,15,7,16},{18,15,21,18},{3,16,6,18},{2,18,5,21},{19,18,22,31},{10,20,17,21},{1,21,4,25},{9,21,17,22},{8,22,17,23},
+{7,23,11,24},{13,23,17,25},{7,24,10,26},{0,25,3,37},{13,25,16,32},{7,26,9,27},{6,27,9,34},{18,31,21,34},{12,32,16,33},{11,33,16,34},
+{6,34,13,35},{14,34,20,36},{7,35,13,36},{8,36,12,37},{15,36,18,37},{1,37,4,40},{2,40,5,42},{3,42,6,43},{16,42,17,43},{4,43,8,44},
+{14,43,17,44},{5,44,17,45},{7,45,14,46},{9,12,14,13},{9,13,15,14},{8,14,15,15},{8,15,11,17},{12,15,15,16},{12,16,16,18},{7,17,11,18},
+{7,18,10,20},{13,18,16,19},{13,19,17,21},{6,20,10,21},{6,21,9,23},{14,21,17,23},{5,23,9,24},{14,23,18,24},{5,24,8,26},{15,24,18,26},
+{4,26,8,27},{15,26,19,28},{4,27,7,29},{16,28,19,29},{3,29,20,32},{2,32,6,34},{17,32,21,34},{2,34,5,35},{18,34,21,35},{1,35,5,37},
+{18,35,22,38},{1,37,4,38},{3,12,14,13},{3,13,16,14},{3,14,17,15},{3,15,6,23},{13,15,17,16},{14,16,18,17},{15,17,18,21},{14,21,17,22},
+{13,22,17,23},{3,23,15,25},{3,25,17,26},{3,26,6,35},{13,26,18,27},{15,27,18,28},{16,28,19,33},{15,33,18,34},{13,34,18,35},{3,35,17,36},
+{3,36,16,37},{3,37,13,38},{10,12,17,13},{8,13,19,14},{6,14,20,15},{5,15,11,16},{17,15,20,16},{4,16,9,17},{19,16,20,17},{4,17,8,18},
+{3,18,8,19},{3,19,7,21},{2,21,6,29},{2,29,7,30},{3,30,7,32},{3,32,8,33},{4,33,9,34},{5,34,11,35},{18,34,20,35},{6,35,20,36},
+{7,36,20,37},{9,37,18,38},{2,12,13,13},{2,13,16,14},{2,14,17,15},{2,15,5,35},{12,15,18,16},{14,16,19,17},{15,17,20,18},{16,18,20,20},
+{17,20,21,29},{16,29,20,31},{15,31,20,32},{15,32,19,33},{14,33,19,34},{11,34,18,35},{2,35,17,36},{2,36,15,37},{2,37,12,38},{4,12,19,15},
+{4,15,7,23},{4,23,19,26},{4,26,7,35},{4,35,19,38},{4,12,19,15},{4,15,7,23},{4,23,18,26},{4,26,7,38},{9,12,16,13},{7,13,18,14},
+{5,14,19,15},{4,15,10,16},{16,15,19,16},{3,16,8,17},{18,16,19,17},{3,17,7,18},{2,18,7,19},{2,19,6,21},{1,21,5,29},{11,23,19,26},
+{16,26,19,35},{1,29,6,30},{2,30,6,32},{2,32,7,33},{3,33,8,34},{4,34,10,35},{5,35,19,36},{6,36,19,37},{8,37,16,38},{2,12,5,23},
+{17,12,20,23},{2,23,20,26},{2,26,5,38},{17,26,20,38},{3,12,18,15},{9,15,12,35},{3,35,18,38},{4,12,17,15},{14,15,17,33},{4,33,5,34},
+{13,33,16,34},{4,34,7,35},{12,34,16,35},{4,35,15,36},{5,36,14,37},{7,37,12,38},{3,12,6,24},{16,12,20,13},{15,13,19,14},{14,14,18,15},
+{13,15,17,16},{12,16,16,18},{11,18,15,19},{10,19,14,20},{9,20,13,21},{8,21,12,22},{8,22,11,23},{7,23,10,24},{3,24,10,26},{3,26,6,38},
+{7,26,11,27},{8,27,12,28},{9,28,13,29},{9,29,14,30},{10,30,14,31},{11,31,15,32},{12,32,16,33},{12,33,17,34},{13,34,18,35},{14,35,18,36},
+{15,36,19,37},{16,37,20,38},{5,12,8,35},{5,35,20,38},{3,12,7,13},{16,12,20,13},{3,13,8,16},{16,13,21,14},{15,14,21,16},{3,16,5,18},
+{6,16,9,19},{15,16,17,17},{18,16,21,30},{14,17,17,19},{2,18,5,33},{7,19,9,20},{14,19,16,20},{7,20,10,22},{13,20,16,21},{13,21,15,23},
+{8,22,10,23},{8,23,11,25},{12,23,15,24},{12,24,14,26},{9,25,11,26},{9,26,14,27},{9,27,13,28},{10,28,13,30},{18,30,22,38},{1,33,5,38},
+{2,12,7,14},{17,12,20,33},{2,14,8,16},{2,16,9,17},{2,17,5,38},{6,17,9,18},{6,18,10,19},{7,19,10,20},{7,20,11,22},{8,22,12,24},
+{9,24,13,26},{10,26,14,28},{11,28,14,29},{11,29,15,30},{12,30,15,31},{12,31,16,32},{13,32,16,33},{13,33,20,34},{14,34,20,36},{15,36,20,38},
+{8,12,15,13},{6,13,17,14},{5,14,18,15},{4,15,8,16},{14,15,19,16},{3,16,7,17},{15,16,19,17},{3,17,6,18},{16,17,20,18},{2,18,5,20},
+{17,18,20,20},{1,20,5,21},{18,20,21,29},{1,21,4,29},{1,29,5,30},{17,29,21,30},{2,30,5,32},{17,30,20,32},{2,32,6,33},{16,32,19,33},
+{3,33,7,34},{15,33,19,34},{3,34,8,35},{14,34,18,35},{4,35,17,36},{5,36,16,37},{7,37,14,38},{3,12,14,13},{3,13,17,14},{3,14,18,15},
+{3,15,6,26},{13,15,19,16},{15,16,19,17},{15,17,20,18},{16,18,20,23},{15,23,19,24},{14,24,19,25},{13,25,18,26},{3,26,17,27},{3,27,16,28},
+{3,28,13,29},{3,29,6,38},{8,12,15,13},{6,13,17,14},{5,14,19,15},{4,15,9,16},{14,15,20,16},{3,16,8,17},{15,16,20,17},{3,17,7,18},
+{16,17,21,18},{2,18,6,21},{17,18,21,20},{18,20,22,29},{1,21,5,30},{17,29,21,32},{2,30,6,32},{2,32,7,33},{16,32,20,33},{3,33,8,34},
+{15,33,20,34},{3,34,9,35},{14,34,19,35},{4,35,18,36},{5,36,17,37},{8,37,15,38},{10,38,13,40},{10,40,14,41},{11,41,15,42},{20,41,22,42},
+{12,42,23,43},{13,43,22,44},{14,44,20,45},{3,12,14,13},{3,13,16,14},{3,14,17,15},{3,15,6,24},{13,15,18,16},{14,16,19,17},{15,17,19,21},
+{14,21,19,22},{14,22,18,23},{12,23,17,24},{3,24,16,25},{3,25,15,26},{3,26,14,27},{3,27,6,38},{11,27,15,28},{12,28,16,29},{13,29,17,31},
+{14,31,18,33},{15,33,19,35},{16,35,20,37},{17,37,21,38},{9,12,17,13},{6,13,19,14},{5,14,19,15},{4,15,9,16},{17,15,19,16},{4,16,8,17},
+{3,17,7,20},{3,20,8,21},{4,21,9,22},{4,22,11,23},{5,23,13,24},{7,24,16,25},{9,25,18,26},{12,26,19,27},{14,27,20,28},{16,28,21,29},
+{17,29,21,33},{16,33,20,34},{3,34,5,35},{14,34,20,35},{3,35,19,36},{3,36,18,37},{5,37,15,38},{1,12,20,15},{9,15,12,38},{2,12,5,32},
+{17,12,20,32},{2,32,6,33},{16,32,19,33},{3,33,6,34},{15,33,19,34},{3,34,8,35},{14,34,18,35},{4,35,18,36},{5,36,16,37},{7,37,14,38},
+{1,12,5,15},{19,12,22,13},{18,13,22,15},{2,15,6,18},{18,15,21,16},{17,16,21,18},{3,18,7,21},{17,18,20,19},{16,19,20,21},{4,21,7,22},
+{16,21,19,22},{4,22,8,24},{15,22,19,24},{5,24,8,25},{15,24,18,25},{5,25,9,27},{14,25,18,27},{6,27,9,28},{14,27,17,28},{6,28,10,31},
+{13,28,17,30},{13,30,16,31},{7,31,11,34},{12,31,16,33},{12,33,15,35},{8,34,11,35},{8,35,15,36},{8,36,14,37},{9,37,14,38},{2,12,5,26},
+{19,12,22,29},{10,21,13,22},{10,22,14,24},{9,24,14,25},{9,25,11,27},{12,25,15,28},{2,26,6,29},{8,27,11,29},{12,28,16,29},{3,29,6,34},
+{8,29,10,31},{13,29,16,31},{18,29,21,33},{7,31,10,33},{14,31,17,33},{7,33,9,34},{14,33,21,34},{3,34,9,36},{15,34,21,37},{3,36,8,38},
+{16,37,21,38},{1,12,6,13},{17,12,21,13},{2,13,6,14},{16,13,20,14},{3,14,7,15},{15,14,19,16},{3,15,8,16},{4,16,8,17},{14,16,18,17},
+{5,17,9,18},{13,17,17,19},{5,18,10,19},{6,19,10,20},{12,19,16,20},{7,20,16,21},{7,21,15,22},{8,22,14,23},{9,23,14,25},{8,25,15,26},
+{7,26,15,27},{7,27,16,28},{6,28,10,30},{12,28,17,29},{13,29,17,30},{5,30,9,31},{13,30,18,31},{4,31,9,32},{14,31,19,32},{4,32,8,33},
+{15,32,19,33},{3,33,7,34},{15,33,20,34},{2,34,7,35},{16,34,21,35},{2,35,6,36},{17,35,21,36},{1,36,5,37},{17,36,22,37},{0,37,5,38},
+{18,37,23,38},{1,12,5,13},{18,12,22,13},{2,13,6,15},{17,13,21,15},{3,15,7,17},{16,15,20,17},{4,17,8,19},{15,17,19,19},{5,19,9,21},
+{14,19,18,21},{6,21,10,22},{14,21,17,22},{7,22,10,23},{13,22,16,24},{7,23,11,24},{8,24,11,25},{12,24,15,25},{8,25,15,26},{9,26,14,28},
+{10,28,13,38},{2,12,20,15},{15,15,19,16},{15,16,18,17},{14,17,18,18},{13,18,17,19},{13,19,16,20},{12,20,16,21},{11,21,15,23},{10,23,14,24},
+{10,24,13,25},{9,25,13,26},{8,26,12,27},{8,27,11,28},{7,28,11,29},{6,29,10,30},{6,30,9,31},{5,31,9,32},{4,32,8,33},{4,33,7,34},
+{3,34,7,35},{2,35,21,38},{7,9,17,12},{7,12,10,43},{7,43,17,46},{3,10,7,11},{4,11,7,13},{5,13,8,15},{5,15,9,16},{6,16,9,17},
+{6,17,10,18},{7,18,10,20},{8,20,11,22},{8,22,12,23},{9,23,12,24},{9,24,13,25},{10,25,13,26},{10,26,14,27},{11,27,14,29},{12,29,15,31},
+{12,31,16,32},{13,32,16,33},{13,33,17,34},{14,34,17,36},{15,36,18,38},{15,38,19,39},{16,39,19,40},{16,40,20,41},{17,41,20,42},{5,9,15,12},
+{12,12,15,43},{5,43,15,46},{10,12,13,13},{9,13,14,15},{8,15,11,17},{12,15,15,16},{12,16,16,17},{7,17,10,18},{13,17,16,18},{6,18,9,20},
+{14,18,17,20},{5,20,8,22},{15,20,18,22},{4,22,7,23},{16,22,19,23},{3,23,6,25},{17,23,20,25},{0,43,23,46},{4,10,8,11},{5,11,9,12},
+{6,12,10,13},{7,13,11,14},{8,14,12,15},{7,18,15,19},{5,19,17,20},{5,20,18,21},{5,21,7,22},{14,21,18,22},{15,22,19,23},{16,23,19,26},
+{8,26,19,27},{6,27,19,28},{4,28,19,29},{4,29,9,30},{16,29,19,33},{3,30,8,31},{3,31,7,34},{14,33,19,34},{3,34,8,35},{12,34,19,35},
+{4,35,19,36},{5,36,15,37},{16,36,19,38},{6,37,13,38},{3,10,6,21},{10,18,16,19},{8,19,17,20},{7,20,18,21},{3,21,10,22},{15,21,19,22},
+{3,22,9,23},{16,22,19,24},{3,23,7,24},{3,24,6,34},{17,24,20,31},{16,31,19,33},{15,33,19,34},{3,34,7,35},{13,34,18,35},{3,35,17,36},
+{3,36,16,37},{6,37,14,38},{10,18,18,19},{8,19,19,20},{6,20,19,21},{5,21,10,22},{17,21,19,22},{5,22,9,23},{4,23,8,24},{4,24,7,25},
+{3,25,6,31},{3,31,7,32},{4,32,7,33},{4,33,8,34},{5,34,10,35},{17,34,19,35},{6,35,19,36},{7,36,19,37},{9,37,17,38},{16,10,19,18},
+{9,18,19,19},{6,19,19,20},{5,20,19,21},{4,21,9,22},{15,21,19,22},{3,22,7,23},{16,22,19,31},{3,23,6,25},{2,25,5,32},{15,31,19,32},
+{3,32,6,34},{14,32,19,33},{13,33,19,34},{3,34,7,35},{12,34,19,35},{4,35,15,36},{16,35,19,38},{5,36,14,37},{6,37,12,38},{8,18,14,19},
+{6,19,16,20},{5,20,17,21},{4,21,8,22},{13,21,18,22},{3,22,7,23},{15,22,18,23},{3,23,6,24},{16,23,19,26},{2,24,5,26},{2,26,19,29},
+{2,29,5,32},{3,32,6,33},{3,33,7,34},{4,34,8,35},{16,34,18,35},{4,35,18,36},{6,36,18,37},{8,37,16,38},{13,10,20,11},{11,11,21,12},
+{10,12,21,13},{9,13,13,14},{19,13,21,14},{9,14,12,15},{8,15,11,21},{2,21,20,24},{8,24,11,38},{7,18,20,19},{6,19,20,20},{5,20,20,21},
+{4,21,8,22},{13,21,17,22},{3,22,7,23},{14,22,18,23},{3,23,6,27},{15,23,18,27},{3,27,7,28},{14,27,18,28},{4,28,8,29},{13,28,17,29},
+{4,29,16,30},{4,30,15,31},{3,31,6,34},{7,31,14,32},{3,34,7,35},{3,35,17,36},{4,36,19,37},{4,37,20,38},{3,38,7,39},{16,38,21,39},
+{2,39,6,42},{17,39,21,41},{16,41,21,42},{2,42,8,43},{15,42,20,43},{3,43,19,44},{4,44,18,45},{6,45,15,46},{3,10,6,21},{10,18,15,19},
+{8,19,17,20},{7,20,18,21},{3,21,10,22},{14,21,18,22},{3,22,9,23},{15,22,19,23},{3,23,7,24},{16,23,19,38},{3,24,6,38},{9,10,12,11},
+{8,11,13,14},{9,14,12,15},{4,18,13,21},{10,21,13,35},{3,35,19,38},{13,10,16,11},{12,11,17,14},{13,14,16,15},{3,18,16,21},{13,21,16,40},
+{12,40,16,41},{12,41,15,42},{2,42,4,43},{11,42,15,43},{2,43,14,44},{2,44,13,45},{3,45,11,46},{4,10,7,27},{16,18,20,19},{15,19,19,20},
+{14,20,18,21},{13,21,17,22},{12,22,16,23},{11,23,15,24},{10,24,14,25},{9,25,13,26},{8,26,12,27},{4,27,11,28},{4,28,7,38},{8,28,12,29},
+{9,29,13,30},{10,30,14,31},{11,31,15,32},{12,32,16,33},{13,33,17,34},{14,34,18,35},{15,35,19,36},{16,36,20,37},{17,37,21,38},{4,10,13,13},
+{10,13,13,35},{3,35,19,38},{2,18,5,20},{7,18,11,19},{15,18,19,19},{6,19,12,20},{14,19,20,20},{2,20,12,21},{13,20,21,21},{2,21,8,22},
+{10,21,16,22},{18,21,21,38},{2,22,7,23},{10,22,15,23},{2,23,6,25},{10,23,14,25},{2,25,5,38},{10,25,13,38},{3,18,6,21},{10,18,16,19},
+{8,19,17,20},{7,20,18,21},{3,21,10,22},{14,21,18,22},{3,22,9,23},{15,22,19,23},{3,23,7,24},{16,23,19,38},{3,24,6,38},{8,18,15,19},
+{6,19,16,20},{5,20,18,21},{4,21,8,22},{14,21,18,22},{3,22,7,23},{15,22,19,23},{3,23,6,24},{16,23,19,24},{2,24,6,25},{16,24,20,25},
+{2,25,5,31},{17,25,20,31},{2,31,6,32},{16,31,20,32},{3,32,6,33},{16,32,19,33},{3,33,7,34},{15,33,19,34},{4,34,8,35},{14,34,18,35},
+{4,35,17,36},{6,36,16,37},{8,37,14,38},{3,18,6,21},{10,18,16,19},{8,19,17,20},{7,20,18,21},{3,21,10,22},{15,21,19,22},{3,22,9,23},
+{16,22,19,24},{3,23,7,24},{3,24,6,34},{17,24,20,31},{16,31,19,33},{15,33,19,34},{3,34,7,35},{13,34,18,35},{3,35,17,36},{3,36,16,37},
+{3,37,13,38},{3,38,6,46},{8,18,16,19},{17,18,19,19},{6,19,19,20},{5,20,19,21},{4,21,9,22},{15,21,19,22},{3,22,7,23},{16,22,19,31},
+{3,23,6,25},{2,25,5,32},{15,31,19,32},{3,32,6,34},{14,32,19,33},{13,33,19,34},{3,34,7,35},{12,34,19,35},{4,35,15,36},{16,35,19,46},
+{5,36,14,37},{6,37,12,38},{4,18,7,21},{11,18,17,19},{9,19,18,20},{8,20,19,21},{4,21,12,22},{15,21,19,22},{4,22,10,23},{16,22,20,23},
+{4,23,9,24},{17,23,20,26},{4,24,8,25},{4,25,7,38},{8,18,16,19},{6,19,18,20},{5,20,18,21},{4,21,8,22},{16,21,18,22},{4,22,7,25},
+{4,25,9,26},{5,26,12,27},{6,27,15,28},{8,28,17,29},{11,29,18,30},{14,30,19,31},{16,31,19,34},{4,34,6,35},{15,34,19,35},{4,35,18,36},
+{4,36,17,37},{6,37,14,38},{8,12,10,13},{7,13,10,18},{1,18,19,21},{7,21,10,34},{7,34,12,35},{18,34,19,35},{8,35,19,36},{9,36,19,37},
+{10,37,18,38},{3,18,6,33},{16,18,19,32},{15,32,19,33},{3,33,7,34},{13,33,19,34},{4,34,8,35},{12,34,19,35},{4,35,15,36},{16,35,19,38},
+{5,36,14,37},{6,37,12,38},{2,18,6,21},{17,18,21,20},{17,20,20,21},{3,21,7,23},{16,21,20,23},{4,23,7,24},{16,23,19,24},{4,24,8,26},
+{15,24,19,25},{15,25,18,27},{5,26,9,28},{14,27,18,28},{6,28,9,29},{14,28,17,29},{6,29,10,31},{13,29,17,30},{13,30,16,32},{7,31,10,32},
+{7,32,11,33},{12,32,16,33},{8,33,11,35},{12,33,15,35},{8,35,14,36},{9,36,14,38},{2,18,5,25},{19,18,22,24},{10,23,13,25},{18,24,22,26},
+{2,25,6,26},{10,25,14,26},{3,26,6,34},{9,26,14,27},{18,26,21,33},{9,27,11,29},{12,27,15,30},{8,29,11,30},{8,30,10,32},{13,30,16,32},
+{7,32,10,34},{13,32,17,33},{14,33,17,34},{18,33,20,34},{4,34,6,35},{7,34,9,35},{14,34,20,35},{4,35,9,37},{15,35,20,38},{4,37,8,38},
+{2,18,7,19},{16,18,21,19},{3,19,7,20},{16,19,20,20},{4,20,8,21},{15,20,19,21},{5,21,9,23},{14,21,18,22},{13,22,18,23},{6,23,10,24},
+{13,23,17,24},{7,24,11,25},{12,24,16,25},{8,25,15,26},{9,26,14,28},{8,28,14,29},{8,29,15,30},{7,30,11,31},{12,30,16,31},{6,31,10,32},
+{13,31,17,32},{5,32,10,33},{14,32,18,34},{5,33,9,34},{4,34,8,35},{15,34,19,35},{3,35,7,36},{16,35,20,36},{2,36,7,37},{16,36,21,37},
+{1,37,6,38},{17,37,22,38},{2,18,6,21},{17,18,21,20},{17,20,20,21},{3,21,7,23},{16,21,20,23},{4,23,7,24},{16,23,19,24},{4,24,8,26},
+{15,24,19,25},{15,25,18,26},{5,26,9,28},{14,26,18,27},{14,27,17,29},{6,28,9,29},{6,29,10,31},{13,29,17,30},{13,30,16,32},{7,31,10,32},
+{7,32,11,33},{12,32,15,34},{8,33,11,34},{8,34,15,35},{8,35,14,36},{9,36,14,37},{9,37,13,39},{9,39,12,40},{8,40,12,41},{7,41,11,42},
+{6,42,11,43},{1,43,10,44},{1,44,9,45},{1,45,7,46},{3,18,19,21},{14,21,18,22},{14,22,17,23},{13,23,16,24},{12,24,16,25},{11,25,15,26},
+{10,26,14,27},{10,27,13,28},{9,28,13,29},{8,29,12,30},{7,30,11,31},{7,31,10,32},{6,32,9,33},{5,33,9,34},{4,34,8,35},{3,35,20,38},
+{13,9,18,10},{11,10,18,11},{10,11,18,12},{10,12,14,13},{9,13,13,14},{9,14,12,23},{8,23,12,24},{7,24,11,25},{3,25,10,26},{3,26,8,27},
+{3,27,10,28},{7,28,11,29},{8,29,12,30},{9,30,12,41},{9,41,13,42},{10,42,14,43},{10,43,18,44},{11,44,18,45},{13,45,18,46},{10,5,13,46},
+{5,9,10,10},{5,10,12,11},{5,11,13,12},{9,12,13,13},{10,13,14,14},{11,14,14,23},{11,23,15,24},{12,24,16,25},{13,25,20,26},{15,26,20,27},
+{13,27,20,28},{12,28,16,29},{11,29,15,30},{11,30,14,41},{10,41,14,42},{9,42,13,43},{5,43,13,44},{5,44,12,45},{5,45,10,46},{4,23,9,24},
+{3,24,11,25},{18,24,21,27},{2,25,12,26},{2,26,5,27},{8,26,13,27},{1,27,4,30},{9,27,14,28},{17,27,20,28},{10,28,20,29},{11,29,19,30},
+{13,30,18,31},
+};
+const Font font = { 24, 48, 32, 126, glyphs, spans };
+}
+
+}
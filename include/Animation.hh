@@ -1,6 +1,11 @@
 #ifndef ANIMATION_HH_
 #define ANIMATION_HH_
+#include <algorithm>
+#include <chrono>
 #include <list>
+#include <memory>
+#include <type_traits>
+#include <vector>
 #include "Render.hh"
 #include "Timer.hh"
 #include "Event.hh"
@@ -35,53 +40,79 @@ namespace easy {
 			: (1 + EaseOutBounce(2 * x - 1)) / 2;
 	}
 
+	struct IAnimation;
+
+	struct _Animation {
+		IAnimation* owner = nullptr;
+		IAnimation* target = nullptr;
+		size_t slot = 0;
+		bool alive = true;
+		virtual ~_Animation() = default;
+		virtual bool step(std::chrono::steady_clock::time_point now, bool shown) = 0;
+	};
+
+	struct Animator {
+		static std::vector<std::unique_ptr<_Animation>>& Active() {
+			static std::vector<std::unique_ptr<_Animation>> active;
+			return active;
+		}
+
+		static bool Running() {
+			return !Active().empty();
+		}
+
+		static void Tick(std::chrono::steady_clock::time_point now);
+		static void Forget(IAnimation* object);
+		static bool Detach(_Animation* anim);
+		static void Retire(_Animation* anim);
+	};
+
 	struct IAnimation {
 	private:
 
 		using AnimationEventHandler = std::function<void(EventArgs)>;
 		std::unordered_map<EventType, std::list<AnimationEventHandler>> listener;
 
-		struct _Animation {
-			IAnimation* owner = nullptr;
-			TimerHandle handle;
-			virtual void step() = 0;
-			void stop() { *handle = false; }
-			bool is_alive() const { return *handle; }
-			static void static_step(_Animation* anim) { anim->step(); }
-		};
-
 		template<typename T, typename O>
 		struct Animation : _Animation {
 			O* ptr;
 			T O::* prop;
 			T from;
 			T to;
-			int curr;
-			int total;
+			std::chrono::steady_clock::time_point start;
+			std::chrono::steady_clock::duration duration;
 			EaseFunction f;
 
-			Animation(IAnimation* owner, O* ptr, T O::* prop, T from, T to, int total, EaseFunction ease = EaseLinear) :
-				ptr(ptr), prop(prop), from(from), to(to), curr(0), total(total), f(ease) { this->owner = owner; }
-
-			void step() {
-				double ratio = f(static_cast<double>(++curr) / total);
-				assign_as_mixture(ptr->*prop, ratio, to, from);
-				Renderer::Invalidated() = true;
-				if (curr == total) {
-					*_Animation::handle = false;
-					bool finish_all = true;
-					for (auto anim : _Animation::owner->anims) finish_all &= !(*anim->handle);
-					if (finish_all) _Animation::owner->FinishAllAnimation(EventArgs { EventType::FinishAllAnimation });
+			Animation(IAnimation* owner, O* ptr, T O::* prop, T from, T to, std::chrono::milliseconds duration, EaseFunction ease = EaseLinear) :
+				ptr(ptr), prop(prop), from(from), to(to), start(std::chrono::steady_clock::now()), duration(duration), f(ease) {
+				this->owner = owner;
+				if constexpr (std::is_base_of_v<IAnimation, O>) this->target = ptr;
+			}
+
+			bool step(std::chrono::steady_clock::time_point now, bool shown) {
+				auto elapsed = now - start;
+				bool finished = elapsed >= duration;
+				if (shown || finished) {
+					double ratio = finished ? 1.0 : std::max(0.0, std::chrono::duration<double>(elapsed) / duration);
+					assign_as_mixture(ptr->*prop, f(ratio), to, from);
+					Renderer::Invalidated() = true;
 				}
+				return finished;
 			}
 		};
-		
-		std::list<_Animation*> anims;
+
+		std::vector<_Animation*> running;
 		bool always_enable = true;
 
+		friend struct Animator;
+
 	protected:
 		IAnimation() = default;
 
+		~IAnimation() {
+			Animator::Forget(this);
+		}
+
 	public:
 
 		_event_forwarder<EventType, EventType::StartAnyAnimation, AnimationEventHandler>
@@ -90,26 +121,65 @@ namespace easy {
 		_event_forwarder<EventType, EventType::FinishAllAnimation, AnimationEventHandler>
 		FinishAllAnimation = { listener, always_enable };
 
+		virtual bool Shown() const {
+			return true;
+		}
+
 		template<typename T, typename O, typename D>
-		void BeginAnimation(std::shared_ptr<D> object, T O::*prop, T from, T to, unsigned miliseconds, EaseFunction ease = EaseLinear, bool multiple = false, double FPS = 40) {
-			unsigned total = static_cast<unsigned>(miliseconds * 0.001 * FPS);
+		void BeginAnimation(std::shared_ptr<D> object, T O::*prop, T from, T to, unsigned miliseconds, EaseFunction ease = EaseLinear, bool multiple = false) {
 			std::shared_ptr<O> optr = object;
-			_Animation* anim = new Animation<T, O>(this, optr.get(), prop, from, to, total, ease);
-			for (auto itor = anims.begin(); itor != anims.end();) {
-				if (!multiple) {
-					Animation<T, O>* cast = dynamic_cast<Animation<T, O>*>(*itor);
-					if (cast && cast->prop == prop) cast->stop();
+			if (!multiple) {
+				for (size_t i = running.size(); i-- > 0;) {
+					Animation<T, O>* cast = dynamic_cast<Animation<T, O>*>(running[i]);
+					if (cast && cast->prop == prop) Animator::Detach(cast);
 				}
-				if (!(*itor)->is_alive()) itor = anims.erase(itor);
-				else itor++;
 			}
-			anim->handle = Timer::RecurrentInvoke(std::max(1, static_cast<int>(1000 / FPS)), 0, _Animation::static_step, anim);
-			anims.push_back(anim);
+			Animator::Active().emplace_back(new Animation<T, O>(this, optr.get(), prop, from, to, std::chrono::milliseconds(miliseconds), ease));
+			Animator::Active().back()->slot = running.size();
+			running.push_back(Animator::Active().back().get());
+			Renderer::Invalidated() = true;
 			StartAnyAnimation(EventArgs { EventType::StartAnyAnimation });
 		}
 
+		template<typename T, typename O, typename D>
+		[[deprecated("animations are evaluated every frame from elapsed time; drop the FPS argument")]]
+		void BeginAnimation(std::shared_ptr<D> object, T O::*prop, T from, T to, unsigned miliseconds, EaseFunction ease, bool multiple, double) {
+			BeginAnimation(object, prop, from, to, miliseconds, ease, multiple);
+		}
+
 	};
 
+	inline void Animator::Tick(std::chrono::steady_clock::time_point now) {
+		auto& active = Active();
+		for (size_t i = 0, count = active.size(); i < count; ++i) {
+			_Animation* anim = active[i].get();
+			if (anim->alive && anim->step(now, !anim->target || anim->target->Shown())) Retire(anim);
+		}
+		active.erase(std::remove_if(active.begin(), active.end(), [](const std::unique_ptr<_Animation>& anim) { return !anim->alive; }), active.end());
+	}
+
+	inline void Animator::Forget(IAnimation* object) {
+		auto& active = Active();
+		for (size_t i = 0, count = active.size(); i < count; ++i) {
+			_Animation* anim = active[i].get();
+			if (!anim->alive) continue;
+			if (anim->owner == object) anim->alive = false;
+			else if (anim->target == object) Retire(anim);
+		}
+	}
+
+	inline bool Animator::Detach(_Animation* anim) {
+		std::vector<_Animation*>& running = anim->owner->running;
+		anim->alive = false;
+		running[anim->slot] = running.back();
+		running[anim->slot]->slot = anim->slot;
+		running.pop_back();
+		return running.empty();
+	}
+
+	inline void Animator::Retire(_Animation* anim) {
+		if (Detach(anim)) anim->owner->FinishAllAnimation(EventArgs { EventType::FinishAllAnimation });
+	}
 
 }
 
@@ -0,0 +1,73 @@
+#ifndef DISPLAY_LIST_HH_
+#define DISPLAY_LIST_HH_
+
+#include <variant>
+#include <vector>
+#include "Font.hh"
+#include "LinearType.hh"
+#include "PixelFormat.hh"
+
+namespace easy {
+
+	struct RenderTarget {
+		uint8_t* Data;
+		size_t Stride;
+		PixelFormat Format;
+		Rect Area;
+		uint8_t* Coverage;
+		uint32_t* Pick;
+
+		uint8_t* Line(int y) const {
+			return Data + (y - Area.Top) * Stride;
+		}
+	};
+
+	struct FillCommand {
+		Rect Area;
+		Color Fill;
+	};
+
+	struct BorderCommand {
+		Rect Area;
+		Rect Thickness;
+		Color Fill;
+	};
+
+	struct SpansCommand {
+		Pos Origin;
+		Color Fill;
+		const GlyphSpan* Spans;
+		size_t Count;
+	};
+
+	struct PickCommand {
+		Rect Area;
+		uint32_t Id;
+	};
+
+	struct BlitCommand {
+		const RenderTarget* Source;
+		const std::vector<Rect>* Runs;
+	};
+
+	struct DrawCommand {
+		Rect Clip;
+		Rect Bounds;
+		std::variant<FillCommand, BorderCommand, SpansCommand, BlitCommand, PickCommand> Op;
+	};
+
+	struct DisplayList {
+		std::vector<DrawCommand> Commands;
+
+		void Clear() {
+			Commands.clear();
+		}
+
+		bool Empty() const {
+			return Commands.empty();
+		}
+	};
+
+}
+
+#endif
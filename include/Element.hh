@@ -3,6 +3,7 @@
 
 #include "Animation.hh"
 #include "Event.hh"
+#include "Layer.hh"
 #include "Render.hh"
 
 namespace easy {
@@ -26,7 +27,7 @@ namespace easy {
 
 	using Element = std::shared_ptr<_Element>;
 
-	struct _Element : IAnimation, IEvent<Element> {
+	struct _Element : IAnimation, IEvent<Element>, std::enable_shared_from_this<_Element> {
 		Rect Margin = {};
 		Size SpecSize = {};
 		Size ActualSize = {};
@@ -37,16 +38,244 @@ namespace easy {
 		Color BackgroundColor = Colors::Trasparent;
 		VerticalAlignType VerticalAlignment = VerticalAlignType::Top;
 		HorizontalAlignType HorizontalAlignment = HorizontalAlignType::Left;
+		bool Cached = false;
+		bool ClipToBounds = false;
+		uint8_t Opacity = 0xFF;
 
-		virtual std::pair<Element, int> MouseTarget(Pos pos) {
+	protected:
+		Rect painted = {};
+		Rect extent = {};
+		Rect reach = {};
+		Color painted_background = Colors::Trasparent;
+		Color painted_border = Colors::Trasparent;
+		uint8_t painted_opacity = 0xFF;
+		bool painted_enable = true;
+		bool painted_clip = false;
+		bool reclipped = false;
+		uint32_t pick_id = 0;
+		uint32_t pick_parent = 0;
+		bool modified = false;
+		bool displayed = true;
+		Layer layer;
+		Rect layout_margin = {};
+		Size layout_spec = {};
+		VerticalAlignType layout_vertical_alignment = VerticalAlignType::Top;
+		HorizontalAlignType layout_horizontal_alignment = HorizontalAlignType::Left;
+		Size measured = { -1, -1 };
+		Size arranged = { -1, -1 };
+		Pos arranged_base = {};
+		bool layout_dirty = true;
+
+		virtual bool Repaint() {
+			bool changed = BackgroundColor != painted_background || BorderColor != painted_border;
+			painted_background = BackgroundColor;
+			painted_border = BorderColor;
+			return changed;
+		}
+
+		virtual bool Relayout() {
+			bool changed = Margin != layout_margin || SpecSize != layout_spec ||
+				VerticalAlignment != layout_vertical_alignment || HorizontalAlignment != layout_horizontal_alignment;
+			layout_margin = Margin;
+			layout_spec = SpecSize;
+			layout_vertical_alignment = VerticalAlignment;
+			layout_horizontal_alignment = HorizontalAlignment;
+			return changed;
+		}
+
+		bool Remeasure(Size size) {
+			if (Relayout()) layout_dirty = true;
+			if (!layout_dirty && size == measured) return false;
+			measured = size;
+			layout_dirty = true;
+			return true;
+		}
+
+		bool Rearrange(Pos base, Size size) {
+			if (!layout_dirty && base == arranged_base && size == arranged) return false;
+			arranged_base = base;
+			arranged = size;
+			layout_dirty = false;
+			return true;
+		}
+
+		static std::vector<_Element*>& Pickable() {
+			static std::vector<_Element*> elements;
+			return elements;
+		}
+
+		static std::vector<uint32_t>& PickFree() {
+			static std::vector<uint32_t> ids;
+			return ids;
+		}
+
+		static std::vector<uint32_t>& PickPending() {
+			static std::vector<uint32_t> ids;
+			return ids;
+		}
+
+		void MarkPick() {
+			if (!pick_id) {
+				if (PickFree().empty()) {
+					Pickable().push_back(this);
+					pick_id = static_cast<uint32_t>(Pickable().size());
+				} else {
+					pick_id = PickFree().back();
+					PickFree().pop_back();
+					Pickable()[pick_id - 1] = this;
+				}
+			}
+			if (!Enable) Renderer::PickBlocked() = true;
+			if (!Renderer::PickBlocked()) pick_parent = Renderer::PickId(), Renderer::PickId() = pick_id;
+			Renderer::DrawPick(Rect::BaseOn(ActualPos, ActualSize), Renderer::PickId());
+		}
+
+		virtual void PickChildren() {}
+
+		bool Uncache(bool changed) {
+			if (reclipped) Renderer::Damage(extent), reclipped = false;
+			if (changed) layer.Valid = false;
+			return changed;
+		}
+
+		bool RenderLayer() {
+			if (!Cached || layer.Recording() || Renderer::Opacity() != 0xFF) return false;
+			if (!layer.Valid) layer.Record(Extent(), [this]() { Render(); });
+			if (layer.Translucent) return false;
+			layer.Blit();
+			if (Renderer::Picking()) PickChildren();
+			return true;
+		}
+
+	public:
+
+		~_Element() {
+			if (!pick_id) return;
+			Pickable()[pick_id - 1] = nullptr;
+			PickPending().push_back(pick_id);
+		}
+
+		static void RecyclePicks() {
+			PickFree().insert(PickFree().end(), PickPending().begin(), PickPending().end());
+			PickPending().clear();
+		}
+
+		static std::pair<Element, int> PickAt(Pos pos) {
+			Rect screen = Renderer::Screen();
+			const std::vector<uint32_t>& buffer = Renderer::PickBuffer();
+			auto miss = std::make_pair(Element(nullptr), std::numeric_limits<int>::max());
+			if (buffer.size() != static_cast<size_t>(screen.Area())) return miss;
+			auto at = [&](Pos p) -> _Element* {
+				if (p.X < 0 || p.Y < 0 || p.X >= screen.Right || p.Y >= screen.Bottom) return nullptr;
+				uint32_t id = buffer[static_cast<size_t>(p.Y) * screen.Right + p.X];
+				return id ? Pickable()[id - 1] : nullptr;
+			};
+			auto inside = [](const _Element* e, const _Element* ancestor) {
+				for (int depth = 0; e && e->pick_parent && depth < 64; ++depth) {
+					e = Pickable()[e->pick_parent - 1];
+					if (e == ancestor) return true;
+				}
+				return false;
+			};
+			_Element* center = at(pos);
+			for (int d = center ? 1 : 0; d <= MouseTargetThreshold; ++d)
+				for (int dx = -d; dx <= d; ++dx)
+					for (int dy = d - std::abs(dx), side = 0; side < (dy ? 2 : 1); ++side, dy = -dy) {
+						_Element* e = at({ pos.X + dx, pos.Y + dy });
+						if (!e || e == center || (center && !inside(e, center))) continue;
+						if (Element target = e->weak_from_this().lock()) return std::make_pair(target, d);
+					}
+			if (center)
+				if (Element target = center->weak_from_this().lock()) return std::make_pair(target, 0);
+			return miss;
+		}
+
+		Rect Bounds() const {
+			Rect bounds = Rect::BaseOn(ActualPos, ActualSize);
+			if (BorderColor.Alpha == 0xFF) return bounds;
+			return {
+				bounds.Left - BorderThickness.Left,
+				bounds.Top - BorderThickness.Top,
+				bounds.Right + BorderThickness.Right,
+				bounds.Bottom + BorderThickness.Bottom
+			};
+		}
+
+		virtual void Invalidate() {
+			Renderer::Damage(painted);
+			painted = {};
+		}
+
+		Rect Extent() const {
+			return extent;
+		}
+
+		Rect Reach() const {
+			return reach;
+		}
+
+		Rect ContentClip() const {
+			if (ClipToBounds) return Rect::BaseOn(ActualPos, ActualSize);
+			return {
+				std::numeric_limits<int>::min(), std::numeric_limits<int>::min(),
+				std::numeric_limits<int>::max(), std::numeric_limits<int>::max()
+			};
+		}
+
+		virtual Rect Opaque() const {
+			if (BackgroundColor.Alpha != 0 || Opacity != 0xFF) return {};
+			return Rect::BaseOn(ActualPos, ActualSize).ClipTo(painted);
+		}
+
+		bool Shown() const override {
+			return Visible && displayed;
+		}
+
+		virtual bool CollectDamage(bool shown) {
+			Rect bounds = shown && Visible ? Bounds() : Rect{};
+			displayed = shown;
+			bool changed = modified;
+			modified = false;
+			if (Opacity != painted_opacity) {
+				Renderer::Damage(extent);
+				painted_opacity = Opacity;
+				changed = true;
+			}
+			if (ClipToBounds != painted_clip) {
+				Renderer::Damage(extent);
+				painted_clip = ClipToBounds;
+				reclipped = changed = true;
+			}
+			if (Enable != painted_enable) {
+				if (Renderer::Picking()) Renderer::Damage(extent);
+				painted_enable = Enable;
+			}
+			if (Repaint() || bounds != painted) {
+				Renderer::Damage(painted);
+				Renderer::Damage(bounds);
+				painted = bounds;
+				changed = true;
+			}
+			extent = painted;
+			return Uncache(changed);
+		}
+
+		virtual std::pair<const Element*, int> Pick(Pos pos) {
 			if (!Enable) return std::make_pair(nullptr, std::numeric_limits<int>::max());
-			int dist = 
-				std::abs(std::abs(pos.X - ActualPos.X) + std::abs(pos.X - ActualPos.X - ActualSize.Width) - ActualSize.Width) / 2
-				+ std::abs(std::abs(pos.Y - ActualPos.Y) + std::abs(pos.Y - ActualPos.Y - ActualSize.Height) - ActualSize.Height) / 2;
-			return std::make_pair(nullptr, dist);
+			return std::make_pair(nullptr, Rect::BaseOn(ActualPos, ActualSize).Distance(pos));
+		}
+
+		virtual std::pair<Element, int> MouseTarget(Pos pos) final {
+			auto hit = Pick(pos);
+			return std::make_pair(hit.first ? *hit.first : nullptr, hit.second);
+		}
+
+		void InvalidateLayout() {
+			layout_dirty = true;
 		}
 
 		virtual void Measure(Size size) {
+			if (!Remeasure(size)) return;
 			ActualSize = {
 				std::max(0, std::min(size.Width - Margin.Right - Margin.Left, SpecSize.Width)),
 				std::max(0, std::min(size.Height - Margin.Top - Margin.Bottom, SpecSize.Height))
@@ -56,6 +285,7 @@ namespace easy {
 		}
 
 		virtual void Arrange(Pos base, Size size) {
+			if (!Rearrange(base, size)) return;
 			if (HorizontalAlignment == HorizontalAlignType::Left)
 				ActualPos.X = base.X + Margin.Left;
 			else if (HorizontalAlignment == HorizontalAlignType::Right)
@@ -68,9 +298,33 @@ namespace easy {
 				ActualPos.Y = base.Y + size.Height - Margin.Bottom - ActualSize.Height;
 			else
 				ActualPos.Y = base.Y + (size.Height - Margin.Top - Margin.Bottom - ActualSize.Height) / 2 + Margin.Top;
+			reach = Rect::BaseOn(ActualPos, ActualSize);
+		}
+		void Compose() {
+			if (!Opacity) return;
+			uint8_t opacity = Renderer::Opacity();
+			uint32_t pick = Renderer::PickId();
+			bool blocked = Renderer::PickBlocked();
+			if (Renderer::Picking() && Visible) MarkPick();
+			Renderer::Opacity() = Span::Scale(opacity, Opacity);
+			Render();
+			Renderer::Opacity() = opacity;
+			Renderer::PickId() = pick;
+			Renderer::PickBlocked() = blocked;
+		}
+
+		void ComposePick() {
+			if (!Opacity || !Visible) return;
+			uint32_t pick = Renderer::PickId();
+			bool blocked = Renderer::PickBlocked();
+			MarkPick();
+			PickChildren();
+			Renderer::PickId() = pick;
+			Renderer::PickBlocked() = blocked;
 		}
+
 		virtual void Render() {
-			if (!Visible) return;
+			if (!Visible || !Renderer::InClip(painted) || RenderLayer()) return;
 			if (BackgroundColor.Alpha != 0xFF)
 				Renderer::DrawFilledRect(Rect::BaseOn(ActualPos, ActualSize), BackgroundColor);
 			if (BorderColor.Alpha != 0xFF)
@@ -87,23 +341,47 @@ namespace easy {
 	void Renderer::MainLoop(T root, double FPS) {
 		Size size = {};
 		RegisterSize(size.Width, size.Height);
+		Renderer::Damage(Renderer::Screen());
 		auto OnRender = [root, size]() {
 			if (Renderer::Invalidated()) {
+				Animator::Tick(FrameScheduler::Clock::now());
 				Pos origin = { 0, 0 };
 				root->Measure(size);
 				root->Arrange(origin, size);
 				root->BeforeRender(root, EventArgs{ EventType::BeforeRender } );
-				root->Render();
+				root->CollectDamage(true);
+				if (Renderer::Picking() && Renderer::PickBuffer().size() != static_cast<size_t>(Renderer::Screen().Area())) {
+					Renderer::PickBuffer().assign(Renderer::Screen().Area(), 0);
+					Renderer::Damage(Renderer::Screen());
+				}
+				Rect screen = Renderer::Clip();
+				Rect opaque = root->Opaque();
+				DisplayList& list = Renderer::Frame();
+				list.Clear();
+				Renderer::List() = &list;
+				for (Rect r : Renderer::Damaged()) {
+					Renderer::Clip() = r;
+					Renderer::Clear(r, opaque);
+					if (Renderer::Picking()) Renderer::DrawPick(r, 0);
+					root->Compose();
+				}
+				Renderer::List() = nullptr;
+				Renderer::Clip() = screen;
+				Renderer::Execute(list);
+				_Element::RecyclePicks();
 				Renderer::Render();
-				Renderer::Invalidated() = false;
+				Renderer::Invalidated() = Animator::Running();
+				return true;
 			}
+			return false;
 		};
-		Timer::RecurrentInvoke(std::max(1, static_cast<int>(1000 / FPS)), 0, OnRender);
+		FrameScheduler frame(FPS, Renderer::RefreshRate(), Renderer::Stats());
 
 		Element on_dragging = nullptr;
 		Pos last_mouse = { -1,-1 };
 
 		while (true) {
+			if (!Renderer::Invalidated()) frame.Idle(FrameScheduler::Clock::now());
 			int* mouse_click_status = Renderer::RegisterMouseClick(nullptr)();
 			Pos mouse = { mouse_click_status[1], mouse_click_status[2] };
 			if (on_dragging) {
@@ -111,18 +389,31 @@ namespace easy {
 				on_dragging->Drag(on_dragging, MouseEventArgs { EventType::Drag, mouse, offset });
 			}
 			if (mouse_click_status[0] == 1 || (mouse_click_status[0] == 2 && !on_dragging)) {
-				auto t = root->MouseTarget(mouse);
+				auto t = Renderer::Picking() ? _Element::PickAt(mouse) : root->MouseTarget(mouse);
 				if (!t.first) t.first = root;
 				if (t.second <= easy::MouseTargetThreshold) {
 					if (mouse_click_status[0] == 1)
 						t.first->Click(t.first, MouseEventArgs { EventType::Click, mouse, {} }),
 						on_dragging = nullptr;
 					else if (mouse_click_status[0] == 2)
-						on_dragging = t.first;
+						on_dragging = t.first,
+						on_dragging->Drag(on_dragging, MouseEventArgs { EventType::Drag, mouse, {} });
 				}
 			}
 			last_mouse = mouse;
 			Timer::Sync();
+			auto now = FrameScheduler::Clock::now();
+			if (Renderer::Invalidated() && frame.Due(now)) {
+				frame.Advance(now);
+				auto vblank = Renderer::VBlank();
+				if (OnRender() && Renderer::VBlank() != vblank)
+					frame.Synchronized(Renderer::VBlank());
+			}
+			FrameScheduler::Clock::time_point deadline;
+			bool timed = Timer::Next(deadline);
+			if (Renderer::Invalidated() && (!timed || frame.next < deadline))
+				deadline = frame.next, timed = true;
+			Renderer::Wait(timed, deadline);
 		}
 	}
 
@@ -0,0 +1,32 @@
+#ifndef FONT_HH_
+#define FONT_HH_
+
+#include <cstdint>
+
+namespace easy {
+
+	struct GlyphSpan {
+		uint8_t Left, Top, Right, Bottom;
+	};
+
+	struct Glyph {
+		uint8_t Left, Top, Right, Bottom;
+		uint16_t First, Count;
+	};
+
+	struct Font {
+		int Width, Height;
+		int First, Last;
+		const Glyph* Glyphs;
+		const GlyphSpan* Spans;
+
+		const Glyph* Find(char c) const {
+			int code = static_cast<unsigned char>(c);
+			if (code < First || code > Last) return nullptr;
+			return Glyphs + (code - First);
+		}
+	};
+
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define GRID_HH_
 
 #include "Element.hh"
+#include "SpatialIndex.hh"
 #include <vector>
 
 namespace easy {
@@ -14,9 +15,12 @@ namespace easy {
 	protected:
 		std::vector<int> row_size, col_size;
 		int row_free, col_free;
+		Size free = {};
 		std::vector<std::vector<Element>> children;
+		SpatialIndex index;
 
 	public:
+		bool Indexed = false;
 
 		_Grid(const std::initializer_list<int>& rows, const std::initializer_list<int>& cols)
 			:
@@ -41,60 +45,102 @@ namespace easy {
 		}
 
 		void Set(int row, int col, const Element& elem) {
+			if (children[row][col]) children[row][col]->Invalidate();
 			children[row][col] = elem;
+			index.Invalidate();
+			modified = true;
 		}
 
 		void Reset(int row, int col) {
+			if (children[row][col]) children[row][col]->Invalidate();
 			children[row][col] = nullptr;
+			index.Invalidate();
+			modified = true;
 		}
 
 		void Clear() {
 			for (auto& i : children)
-				for (auto& j : i)
+				for (auto& j : i) {
+					if (j) j->Invalidate();
 					j = nullptr;
+				}
+			index.Invalidate();
+			modified = true;
 		}
 
-		std::pair<Element, int> MouseTarget(Pos pos) {
-			if (!Enable) return std::make_pair(nullptr, std::numeric_limits<int>::max());
-			std::vector<std::pair<Element, int>> results;
-			using itor = std::vector<std::pair<Element, int>>::iterator;
-			auto comp = [](const std::pair<Element, int>& a, const std::pair<Element, int>& b) {
-				return a.second < b.second;
-			};
-			for (auto& i : children)
-				for (auto& j : i)
-					if (j) {
-						auto result = j->MouseTarget(pos);
-						if (!result.first) result.first = j;
-						results.push_back(result);
+		void Invalidate() {
+			_Element::Invalidate();
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item) item->Invalidate();
+		}
+
+		Rect Opaque() const {
+			Rect opaque = _Element::Opaque();
+			if (!opaque.Empty() || Opacity != 0xFF) return opaque;
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item) {
+						Rect r = item->Opaque().ClipTo(ContentClip());
+						if (r.Area() > opaque.Area()) opaque = r;
 					}
-			if (results.empty()) return _Element::MouseTarget(pos);
-			itor p = results.begin();
-			if (results.size() > 1) p = std::min_element(results.begin(), results.end(), comp);
-			if (p->second > MouseTargetThreshold) return _Element::MouseTarget(pos);
-			return *p;
+			return opaque;
+		}
+
+		bool CollectDamage(bool shown) {
+			bool changed = _Element::CollectDamage(shown);
+			shown = shown && Visible;
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item) {
+						if (shown) item->BeforeRender(item, EventArgs{ EventType::BeforeRender });
+						changed = item->CollectDamage(shown) || changed;
+					}
+			Rect content = ContentClip();
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item) extent = extent.Union(item->Extent().ClipTo(content));
+			return Uncache(changed);
+		}
+
+		std::pair<const Element*, int> Pick(Pos pos) {
+			if (!Enable) return _Element::Pick(pos);
+			if (Indexed && index.Valid()) {
+				auto best = index.Pick(pos);
+				return best.first ? best : _Element::Pick(pos);
+			}
+			std::pair<const Element*, int> best = std::make_pair(nullptr, MouseTargetThreshold + 1);
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item && item->Reach().Distance(pos) < best.second) {
+						auto hit = item->Pick(pos);
+						if (hit.second < best.second) best = std::make_pair(hit.first ? hit.first : &item, hit.second);
+					}
+			return best.first ? best : _Element::Pick(pos);
 		}
 
 		void Measure(Size size) {
-			Size margin = {
-				std::max(0, size.Width - Margin.Right - Margin.Left - SpecSize.Width),
-				std::max(0, size.Height - Margin.Top - Margin.Bottom - SpecSize.Height),
-			};
-			if (row_free > 0) margin.Height = margin.Height / row_free;
-			if (col_free > 0) margin.Width = margin.Width / col_free;
+			if (Remeasure(size)) {
+				free = {
+					std::max(0, size.Width - Margin.Right - Margin.Left - SpecSize.Width),
+					std::max(0, size.Height - Margin.Top - Margin.Bottom - SpecSize.Height),
+				};
+				if (row_free > 0) free.Height = free.Height / row_free;
+				if (col_free > 0) free.Width = free.Width / col_free;
+				ActualSize = {
+					std::max(0, std::min(size.Width - Margin.Right - Margin.Left, SpecSize.Width + col_free * free.Width)),
+					std::max(0, std::min(size.Height - Margin.Top - Margin.Bottom, SpecSize.Height + row_free * free.Height))
+				};
+			}
 			for (int r = 0; r < (int)row_size.size(); ++r) {
 				for (int c = 0; c < (int)col_size.size(); ++c) {
 					if (!children[r][c]) continue;
 					Size arranged = { col_size[c], row_size[r] };
-					if (arranged.Height == 0) arranged.Height = margin.Height;
-					if (arranged.Width == 0) arranged.Width = margin.Width;
+					if (arranged.Height == 0) arranged.Height = free.Height;
+					if (arranged.Width == 0) arranged.Width = free.Width;
 					children[r][c]->Measure(arranged);
 				}
 			}
-			ActualSize = {
-				std::max(0, std::min(size.Width - Margin.Right - Margin.Left, SpecSize.Width + col_free * margin.Width)),
-				std::max(0, std::min(size.Height - Margin.Top - Margin.Bottom, SpecSize.Height + row_free * margin.Height))
-			};
 		}
 
 		void Arrange(Pos base, Size size) {
@@ -119,17 +165,34 @@ namespace easy {
 				}
 				rel.Y += arranged.Height;
 			}
+			reach = Rect::BaseOn(ActualPos, ActualSize);
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item) reach = reach.Hull(item->Reach());
+			if (!Indexed) return index.Invalidate();
+			index.Update(Rect::BaseOn(ActualPos, ActualSize), [this](auto&& add) {
+				for (auto& rows : children)
+					for (auto& item : rows)
+						if (item) add(&item);
+			});
 		}
 		
+		void PickChildren() {
+			Renderer::PushClip(ContentClip());
+			for (auto& rows : children)
+				for (auto& item : rows)
+					if (item && Renderer::InClip(item->Extent())) item->ComposePick();
+			Renderer::PopClip();
+		}
+
 		void Render() {
-			if (!Visible) return;
+			if (!Visible || !Renderer::InClip(extent) || RenderLayer()) return;
 			_Element::Render();
+			Renderer::PushClip(ContentClip());
 			for (auto& rows : children)
 				for (auto& item : rows)
-					if (item) {
-						item->BeforeRender(item, EventArgs{ EventType::BeforeRender });
-						item->Render();
-					}
+					if (item && Renderer::InClip(item->Extent())) item->Compose();
+			Renderer::PopClip();
 		}
 
 	};
@@ -123,8 +123,8 @@ namespace easy {
 
 			struct FrameHelper {
 				template<typename T> FrameHelper(const T& elem) { Frame::Push(new Frame(elem)); }
-				template<> FrameHelper(const Grid& elem) { Frame::Push(new GridFrame(elem)); }
-				template<> FrameHelper(const OverlapPanel& elem) { Frame::Push(new OverlapPanelFrame(elem)); }
+				FrameHelper(const Grid& elem) { Frame::Push(new GridFrame(elem)); }
+				FrameHelper(const OverlapPanel& elem) { Frame::Push(new OverlapPanelFrame(elem)); }
 				FrameHelper(const FrameHelper&) = delete;
 				~FrameHelper() { Frame::Pop(); }
 				operator bool() const { return true; }
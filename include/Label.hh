@@ -3,7 +3,7 @@
 
 #include <iostream>
 #include "Element.hh"
-#include "font/font.cc"
+#include "font/spans.cc"
 
 namespace easy {
 
@@ -28,16 +28,24 @@ namespace easy {
 			16,20,24,28,32,40,48
 		};
 
-		const uint8_t* source[7] = {
-			font16::data,
-			font20::data,
-			font24::data,
-			font28::data,
-			font32::data,
-			font40::data,
-			font48::data
+		const Font* fonts[7] = {
+			&spans16::font,
+			&spans20::font,
+			&spans24::font,
+			&spans28::font,
+			&spans32::font,
+			&spans40::font,
+			&spans48::font
 		};
 
+		std::string painted_text;
+		Color painted_font_color = {};
+		FontSizeType painted_font_size = FontSizeType::Medium;
+		VerticalAlignType painted_font_vertical_alignment = VerticalAlignType::Center;
+		HorizontalAlignType painted_font_horizontal_alignment = HorizontalAlignType::Center;
+		size_t layout_text_length = 0;
+		FontSizeType layout_font_size = FontSizeType::Medium;
+
 	public:
 
 		std::string Text;
@@ -46,7 +54,33 @@ namespace easy {
 		VerticalAlignType FontVerticalAlignment = VerticalAlignType::Center;
 		HorizontalAlignType FontHorizontalAlignment = HorizontalAlignType::Center;
 
+	protected:
+
+		bool Repaint() {
+			bool changed = _Element::Repaint();
+			changed |= Text != painted_text || FontColor != painted_font_color || FontSize != painted_font_size ||
+				FontVerticalAlignment != painted_font_vertical_alignment ||
+				FontHorizontalAlignment != painted_font_horizontal_alignment;
+			painted_text = Text;
+			painted_font_color = FontColor;
+			painted_font_size = FontSize;
+			painted_font_vertical_alignment = FontVerticalAlignment;
+			painted_font_horizontal_alignment = FontHorizontalAlignment;
+			return changed;
+		}
+
+		bool Relayout() {
+			bool changed = _Element::Relayout() || FontSize != layout_font_size ||
+				(SpecSize.Width == 0 && Text.length() != layout_text_length);
+			layout_text_length = Text.length();
+			layout_font_size = FontSize;
+			return changed;
+		}
+
+	public:
+
 		void Measure(Size size) {
+			if (!Remeasure(size)) return;
 			Size fsize = SpecSize;
 			if (fsize.Width == 0) fsize.Width = font_size[static_cast<int>(FontSize)] * static_cast<int>(Text.length()) / 2;
 			if (fsize.Height == 0) fsize.Height = font_size[static_cast<int>(FontSize)];
@@ -57,8 +91,10 @@ namespace easy {
 		}
 
 		void Render() {
-			if (!Visible) return;
+			if (!Visible || RenderLayer()) return;
 			_Element::Render();
+			Rect ActualRect = Rect::BaseOn(ActualPos, ActualSize);
+			if (!Renderer::InClip(ActualRect)) return;
 			Size fsize = Size{ font_size[static_cast<int>(FontSize)] / 2, font_size[static_cast<int>(FontSize)] };
 			int len = static_cast<int>(Text.length());
 			Pos margin = {};
@@ -70,15 +106,17 @@ namespace easy {
 				margin.Y = (ActualSize.Height - fsize.Height) / 2;
 			else if (FontVerticalAlignment == VerticalAlignType::Bottom)
 				margin.Y = ActualSize.Height - fsize.Height;
-			Rect ActualRect = Rect::BaseOn(ActualPos, ActualSize);
+			Renderer::PushClip(ActualRect);
+			const Font& font = *fonts[static_cast<int>(FontSize)];
 			for (char c : Text) {
-				int offset = static_cast<int>(c) * ((fsize.Width + 7) / 8) * fsize.Height;
-				Renderer::DrawByMask(Rect::BaseOn(ActualPos + margin, fsize).ClipTo(ActualRect),
-									 FontColor,
-									 source[static_cast<int>(FontSize)] + offset,
-									 fsize);
+				Pos origin = ActualPos + margin;
+				const Glyph* glyph = font.Find(c);
+				if (glyph && glyph->Count &&
+					Renderer::InClip({ origin.X + glyph->Left, origin.Y + glyph->Top, origin.X + glyph->Right, origin.Y + glyph->Bottom }))
+					Renderer::DrawSpans(origin, FontColor, font.Spans + glyph->First, glyph->Count);
 				margin.X += fsize.Width;
 			}
+			Renderer::PopClip();
 		}
 
 
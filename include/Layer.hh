@@ -0,0 +1,73 @@
+#ifndef LAYER_HH_
+#define LAYER_HH_
+
+#include <vector>
+#include "Render.hh"
+
+namespace easy {
+
+	struct Layer {
+	protected:
+		std::vector<uint8_t> pixels;
+		std::vector<uint8_t> coverage;
+		std::vector<Rect> runs;
+		RenderTarget target = {};
+		bool recording = false;
+
+	public:
+		bool Valid = false;
+		bool Translucent = false;
+
+		bool Recording() const {
+			return recording;
+		}
+
+		Rect Area() const {
+			return target.Area;
+		}
+
+		template<typename F>
+		void Record(Rect area, F&& render) {
+			RenderTarget parent = Renderer::Current();
+			area = area.ClipTo(Renderer::Screen());
+			area.Left &= ~3;
+			area.Top &= ~3;
+			int width = std::max(0, area.Right - area.Left), height = std::max(0, area.Bottom - area.Top);
+			int bytes = 4;
+			WithPixelFormat(parent.Format, [&](auto format) { bytes = decltype(format)::Bytes; });
+			pixels.resize(static_cast<size_t>(width) * height * bytes);
+			coverage.assign(static_cast<size_t>(width) * height, 0);
+			target = { pixels.data(), static_cast<size_t>(width) * bytes, parent.Format, area, coverage.data() };
+
+			RenderTarget* saved_target = Renderer::Target();
+			Rect saved_clip = Renderer::Clip();
+			Renderer::Target() = &target;
+			Renderer::Clip() = area;
+			recording = true;
+			render();
+			recording = false;
+			Renderer::Clip() = saved_clip;
+			Renderer::Target() = saved_target;
+
+			runs.clear();
+			Translucent = false;
+			for (int j = 0; j < height; ++j) {
+				const uint8_t* row = coverage.data() + static_cast<size_t>(j) * width;
+				for (int i = 0; i < width;) {
+					if (!row[i]) { ++i; continue; }
+					int begin = i;
+					while (i < width && row[i]) Translucent |= row[i++] > 1;
+					runs.push_back({ area.Left + begin, area.Top + j, area.Left + i, area.Top + j + 1 });
+				}
+			}
+			Valid = true;
+		}
+
+		void Blit() const {
+			Renderer::DrawBlit(target, runs);
+		}
+	};
+
+}
+
+#endif
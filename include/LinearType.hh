@@ -1,9 +1,51 @@
 #ifndef LINEAR_TYPE_HH_
 #define LINEAR_TYPE_HH_
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
+
+#ifndef EASY_FIXED_POINT
+#define EASY_FIXED_POINT 1
+#endif
 
 namespace easy {
 
+	struct FixedPoint {
+		static constexpr int Shift = 16;
+		static constexpr int64_t One = int64_t(1) << Shift;
+
+#if EASY_FIXED_POINT
+		static constexpr int64_t Ratio(double k) {
+			return static_cast<int64_t>(k * One + (k < 0 ? -0.5 : 0.5));
+		}
+#else
+		static constexpr double Ratio(double k) {
+			return k;
+		}
+#endif
+
+		template<typename V>
+		static constexpr double Scale(V x, double k) {
+			return x * k;
+		}
+
+		template<typename V>
+		static constexpr int64_t Scale(V x, int64_t q) {
+			return static_cast<int64_t>(x) * q / One;
+		}
+
+		template<typename V>
+		static constexpr V Mix(V s1, V s2, double r) {
+			return static_cast<V>(r * s1 + (1 - r) * s2);
+		}
+
+		template<typename V>
+		static constexpr V Mix(V s1, V s2, int64_t q) {
+			if constexpr (std::is_floating_point_v<V>) return Mix(s1, s2, static_cast<double>(q) / One);
+			else return static_cast<V>((static_cast<int64_t>(s2) * One + (static_cast<int64_t>(s1) - s2) * q) / One);
+		}
+	};
+
 
 	template<typename T, typename V, unsigned N> struct Linear;
 
@@ -46,14 +88,16 @@ namespace easy {
 
 		constexpr T& operator *=(double k) {
 			auto& [x, y] = *static_cast<T*>(this);
-			x *= k;
-			y *= k;
+			auto q = FixedPoint::Ratio(k);
+			x = static_cast<V>(FixedPoint::Scale(x, q));
+			y = static_cast<V>(FixedPoint::Scale(y, q));
 			return *static_cast<T*>(this);
 		}
 
 		constexpr T operator *(double k) const {
 			auto [x, y] = *static_cast<const T*>(this);
-			return { static_cast<V>(static_cast<SV>(x * k)), static_cast<V>(static_cast<SV>(y * k)) };
+			auto q = FixedPoint::Ratio(k);
+			return { static_cast<V>(static_cast<SV>(FixedPoint::Scale(x, q))), static_cast<V>(static_cast<SV>(FixedPoint::Scale(y, q))) };
 		}
 
 		constexpr bool operator ==(const T& rhs) const {
@@ -108,16 +152,21 @@ namespace easy {
 
 		constexpr T& operator *=(double k) {
 			auto& [x, y, z, w] = *static_cast<T*>(this);
-			x *= k;
-			y *= k;
-			z *= k;
-			w *= k;
+			auto q = FixedPoint::Ratio(k);
+			x = static_cast<V>(FixedPoint::Scale(x, q));
+			y = static_cast<V>(FixedPoint::Scale(y, q));
+			z = static_cast<V>(FixedPoint::Scale(z, q));
+			w = static_cast<V>(FixedPoint::Scale(w, q));
 			return *static_cast<T*>(this);
 		}
 
 		constexpr T operator *(double k) const {
 			auto [x, y, z, w] = *static_cast<const T*>(this);
-			return { static_cast<V>(static_cast<SV>(x * k)), static_cast<V>(static_cast<SV>(y * k)), static_cast<V>(static_cast<SV>(z * k)), static_cast<V>(static_cast<SV>(w * k)) };
+			auto q = FixedPoint::Ratio(k);
+			return {
+				static_cast<V>(static_cast<SV>(FixedPoint::Scale(x, q))), static_cast<V>(static_cast<SV>(FixedPoint::Scale(y, q))),
+				static_cast<V>(static_cast<SV>(FixedPoint::Scale(z, q))), static_cast<V>(static_cast<SV>(FixedPoint::Scale(w, q)))
+			};
 		}
 
 		constexpr bool operator ==(const T& rhs) const {
@@ -129,16 +178,18 @@ namespace easy {
 
 	};
 
-	template<typename T, typename V = typename T::linear_length>
-	struct linear_length : V {};
+	template<typename T, typename = void>
+	struct linear_length : std::integral_constant<unsigned, 0> {};
+
+	template<typename T>
+	struct linear_length<T, std::void_t<typename T::linear_length>> : T::linear_length {};
 
 	template<typename T>
-	struct linear_length<T, void> : std::integral_constant<unsigned, 0> {};
+	struct linear_length<T, std::enable_if_t<std::is_arithmetic_v<T>>> : std::integral_constant<unsigned, 1> {};
 
 	template<typename T, std::enable_if_t<linear_length<T>::value == 1, int> I = 0>
 	static constexpr T& assign_as_mixture(T& dest, double ratio1, const T& s1, const T& s2) {
-		double ratio2 = 1 - ratio1;
-		dest = static_cast<T>(ratio1 * s1 + ratio2 * s2);
+		dest = FixedPoint::Mix(s1, s2, FixedPoint::Ratio(ratio1));
 		return dest;
 	}
 
@@ -147,9 +198,9 @@ namespace easy {
 		auto [x1, y1] = s1;
 		auto [x2, y2] = s2;
 		auto& [x, y] = dest;
-		double ratio2 = 1 - ratio1;
-		x = static_cast<decltype(x)>(ratio1 * x1 + ratio2 * x2);
-		y = static_cast<decltype(y)>(ratio1 * y1 + ratio2 * y2);
+		auto q = FixedPoint::Ratio(ratio1);
+		x = FixedPoint::Mix(x1, x2, q);
+		y = FixedPoint::Mix(y1, y2, q);
 		return dest;
 	}
 
@@ -158,11 +209,11 @@ namespace easy {
 		auto [x1, y1, z1, w1] = s1;
 		auto [x2, y2, z2, w2] = s2;
 		auto& [x, y, z, w] = dest;
-		double ratio2 = 1 - ratio1;
-		x = static_cast<decltype(x)>(ratio1 * x1 + ratio2 * x2);
-		y = static_cast<decltype(y)>(ratio1 * y1 + ratio2 * y2);
-		z = static_cast<decltype(z)>(ratio1 * z1 + ratio2 * z2);
-		w = static_cast<decltype(w)>(ratio1 * w1 + ratio2 * w2);
+		auto q = FixedPoint::Ratio(ratio1);
+		x = FixedPoint::Mix(x1, x2, q);
+		y = FixedPoint::Mix(y1, y2, q);
+		z = FixedPoint::Mix(z1, z2, q);
+		w = FixedPoint::Mix(w1, w2, q);
 		return dest;
 	}
 
@@ -189,6 +240,10 @@ namespace easy {
 				static_cast<uint8_t>(ARGB & 0xff)
 			};
 		}
+
+		constexpr uint32_t ToARGB() const {
+			return static_cast<uint32_t>(Alpha) << 24 | static_cast<uint32_t>(Red) << 16 | static_cast<uint32_t>(Green) << 8 | Blue;
+		}
 	};
 
 	namespace Colors {
@@ -239,6 +294,42 @@ namespace easy {
 			};
 		}
 
+		constexpr Rect Union(Rect rect) const {
+			if (rect.Empty()) return *this;
+			if (Empty()) return rect;
+			return {
+				std::min(rect.Left, Left), std::min(rect.Top, Top),
+				std::max(rect.Right, Right), std::max(rect.Bottom, Bottom)
+			};
+		}
+
+		constexpr Rect Hull(Rect rect) const {
+			return {
+				std::min(rect.Left, Left), std::min(rect.Top, Top),
+				std::max(rect.Right, Right), std::max(rect.Bottom, Bottom)
+			};
+		}
+
+		constexpr bool Empty() const {
+			return Left >= Right || Top >= Bottom;
+		}
+
+		constexpr int Distance(Pos pos) const {
+			return std::max(0, std::max(Left - pos.X, pos.X - Right)) + std::max(0, std::max(Top - pos.Y, pos.Y - Bottom));
+		}
+
+		constexpr long long Area() const {
+			return Empty() ? 0 : static_cast<long long>(Right - Left) * (Bottom - Top);
+		}
+
+		constexpr bool Intersects(Rect rect) const {
+			return !ClipTo(rect).Empty();
+		}
+
+		constexpr bool Contains(Rect rect) const {
+			return rect.Left >= Left && rect.Top >= Top && rect.Right <= Right && rect.Bottom <= Bottom;
+		}
+
 		constexpr static Rect BaseOn(Pos pos, Size size) {
 			return {
 				pos.X,
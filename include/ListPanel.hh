@@ -0,0 +1,173 @@
+#ifndef LIST_PANEL_HH_
+#define LIST_PANEL_HH_
+
+#include "Element.hh"
+#include <functional>
+#include <vector>
+
+namespace easy {
+
+	struct _ListPanel;
+
+	using ListPanel = std::shared_ptr<_ListPanel>;
+
+	struct _ListPanel : _Element {
+		using ItemFactory = std::function<Element()>;
+		using ItemBinder = std::function<void(const Element&, size_t)>;
+
+		static constexpr size_t Unbound = static_cast<size_t>(-1);
+
+	protected:
+		ItemFactory factory;
+		ItemBinder binder;
+		std::vector<Element> pool;
+		std::vector<size_t> bound;
+		int scrolled = 0;
+
+		void Release(size_t slot) {
+			if (bound[slot] == Unbound) return;
+			if (pool[slot]) pool[slot]->Invalidate();
+			bound[slot] = Unbound;
+		}
+
+		void Bind(size_t first, size_t last) {
+			size_t n = pool.size();
+			for (size_t slot = 0; slot < n; ++slot) {
+				size_t index = first + (slot + n - first % n) % n;
+				if (index >= last) {
+					Release(slot);
+					continue;
+				}
+				if (bound[slot] == index) continue;
+				if (!pool[slot]) pool[slot] = factory();
+				else if (bound[slot] == Unbound) pool[slot]->Invalidate();
+				binder(pool[slot], index);
+				bound[slot] = index;
+			}
+		}
+
+	public:
+		size_t Count = 0;
+		int ItemHeight;
+		int Offset = 0;
+
+		_ListPanel(int item_height, ItemFactory factory, ItemBinder binder) :
+			factory(std::move(factory)), binder(std::move(binder)), ItemHeight(item_height) {
+			ClipToBounds = true;
+		}
+
+		size_t Capacity() const {
+			return pool.size();
+		}
+
+		void Refresh() {
+			for (size_t& index : bound) index = Unbound;
+			modified = true;
+		}
+
+		void ScrollTo(size_t index) {
+			Offset = static_cast<int>(index) * ItemHeight;
+		}
+
+		void Invalidate() {
+			_Element::Invalidate();
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound) pool[slot]->Invalidate();
+		}
+
+		Rect Opaque() const {
+			Rect opaque = _Element::Opaque();
+			if (!opaque.Empty() || Opacity != 0xFF) return opaque;
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound) {
+					Rect r = pool[slot]->Opaque().ClipTo(ContentClip());
+					if (r.Area() > opaque.Area()) opaque = r;
+				}
+			return opaque;
+		}
+
+		bool CollectDamage(bool shown) {
+			bool changed = _Element::CollectDamage(shown);
+			shown = shown && Visible;
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound) {
+					Element& item = pool[slot];
+					if (shown) item->BeforeRender(item, EventArgs{ EventType::BeforeRender });
+					changed = item->CollectDamage(shown) || changed;
+				}
+			Rect content = ContentClip();
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound) extent = extent.Union(pool[slot]->Extent().ClipTo(content));
+			return Uncache(changed);
+		}
+
+		std::pair<const Element*, int> Pick(Pos pos) {
+			if (!Enable) return _Element::Pick(pos);
+			Rect view = Rect::BaseOn(ActualPos, ActualSize);
+			std::pair<const Element*, int> best = std::make_pair(nullptr, MouseTargetThreshold + 1);
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound && pool[slot]->Reach().ClipTo(view).Distance(pos) < best.second) {
+					auto hit = pool[slot]->Pick(pos);
+					hit.second = std::max(hit.second, view.Distance(pos));
+					if (hit.second < best.second) best = std::make_pair(hit.first ? hit.first : &pool[slot], hit.second);
+				}
+			return best.first ? best : _Element::Pick(pos);
+		}
+
+		void Measure(Size size) {
+			if (Remeasure(size))
+				ActualSize = {
+					std::max(0, std::min(size.Width - Margin.Right - Margin.Left, SpecSize.Width ? SpecSize.Width : size.Width)),
+					std::max(0, std::min(size.Height - Margin.Top - Margin.Bottom, SpecSize.Height ? SpecSize.Height : size.Height))
+				};
+			size_t n = ItemHeight > 0 ? static_cast<size_t>((ActualSize.Height + ItemHeight - 1) / ItemHeight + 1) : 0;
+			if (n != pool.size()) {
+				for (size_t slot = 0; slot < pool.size(); ++slot) Release(slot);
+				pool.resize(n);
+				bound.assign(n, Unbound);
+			}
+			if (!n) return;
+			long long total = static_cast<long long>(Count) * ItemHeight;
+			scrolled = static_cast<int>(std::max(0LL, std::min<long long>(Offset, total - ActualSize.Height)));
+			size_t first = static_cast<size_t>(scrolled / ItemHeight);
+			size_t last = std::min(Count, static_cast<size_t>((scrolled + ActualSize.Height + ItemHeight - 1) / ItemHeight));
+			Bind(first, std::max(first, last));
+			for (size_t slot = 0; slot < n; ++slot)
+				if (bound[slot] != Unbound) pool[slot]->Measure({ ActualSize.Width, ItemHeight });
+		}
+
+		void Arrange(Pos base, Size size) {
+			_Element::Arrange(base, size);
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound) {
+					Pos origin = { ActualPos.X, ActualPos.Y + static_cast<int>(bound[slot]) * ItemHeight - scrolled };
+					pool[slot]->Arrange(origin, { ActualSize.Width, ItemHeight });
+				}
+			reach = Rect::BaseOn(ActualPos, ActualSize);
+		}
+
+		void PickChildren() {
+			Renderer::PushClip(ContentClip());
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound && Renderer::InClip(pool[slot]->Extent())) pool[slot]->ComposePick();
+			Renderer::PopClip();
+		}
+
+		void Render() {
+			if (!Visible || !Renderer::InClip(extent) || RenderLayer()) return;
+			_Element::Render();
+			Renderer::PushClip(ContentClip());
+			for (size_t slot = 0; slot < pool.size(); ++slot)
+				if (bound[slot] != Unbound && Renderer::InClip(pool[slot]->Extent())) pool[slot]->Compose();
+			Renderer::PopClip();
+		}
+
+	};
+
+	ListPanel MakeListPanel(int item_height, const _ListPanel::ItemFactory& factory, const _ListPanel::ItemBinder& binder) {
+		return ListPanel(new _ListPanel(item_height, factory, binder));
+	}
+
+}
+
+#endif
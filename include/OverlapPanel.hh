@@ -2,6 +2,7 @@
 #define OverlapPanel_HH_
 
 #include "Element.hh"
+#include "SpatialIndex.hh"
 #include <list>
 
 namespace easy {
@@ -13,16 +14,22 @@ namespace easy {
 	struct _OverlapPanel : _Element {
 	protected:
 		std::list<Element> children;
+		std::vector<Rect> occluders;
+		std::vector<char> occluded;
+		SpatialIndex index;
 
 	public:
+		bool Indexed = false;
 
 		_OverlapPanel() {}
 
 		void Add(const Element& elem) {
 			children.push_back(elem);
+			index.Invalidate();
 		}
 
 		void AddAt(const Element& elem, int index) {
+			this->index.Invalidate();
 			if (index == 0) return children.push_front(elem);
 			auto p = children.begin();
 			for (int i = 0; i < index; ++i) ++p;
@@ -38,44 +45,81 @@ namespace easy {
 		}
 
 		void Remove(const Element& elem) {
+			if (elem) elem->Invalidate();
 			children.remove(elem);
+			index.Invalidate();
+			modified = true;
 		}
 
 		void RemoveAt(int index) {
 			auto p = children.begin();
 			for (int i = 0; i < index; ++i) ++p;
+			if (*p) (*p)->Invalidate();
 			children.erase(p);
+			this->index.Invalidate();
+			modified = true;
 		}
 
 		void Clear() {
+			for (auto& child : children)
+				if (child) child->Invalidate();
 			children.clear();
+			index.Invalidate();
+			modified = true;
 		}
 
-		std::pair<Element, int> MouseTarget(Pos pos) {
-			if (!Enable) return std::make_pair(nullptr, std::numeric_limits<int>::max());
-			std::vector<std::pair<Element, int>> results;
-			using itor = std::vector<std::pair<Element, int>>::iterator;
-			auto comp = [](const std::pair<Element, int>& a, const std::pair<Element, int>& b) {
-				return a.second < b.second;
-			};
-			for (auto& j : children)
-				if (j) {
-					auto result = j->MouseTarget(pos);
-					if (!result.first) result.first = j;
-					results.push_back(result);
+		void Invalidate() {
+			_Element::Invalidate();
+			for (auto& child : children)
+				if (child) child->Invalidate();
+		}
+
+		Rect Opaque() const {
+			Rect opaque = _Element::Opaque();
+			if (!opaque.Empty() || Opacity != 0xFF) return opaque;
+			for (auto& child : children)
+				if (child) {
+					Rect r = child->Opaque().ClipTo(ContentClip());
+					if (r.Area() > opaque.Area()) opaque = r;
+				}
+			return opaque;
+		}
+
+		bool CollectDamage(bool shown) {
+			bool changed = _Element::CollectDamage(shown);
+			shown = shown && Visible;
+			for (auto& child : children)
+				if (child) {
+					if (shown) child->BeforeRender(child, EventArgs{ EventType::BeforeRender });
+					changed = child->CollectDamage(shown) || changed;
+				}
+			Rect content = ContentClip();
+			for (auto& child : children)
+				if (child) extent = extent.Union(child->Extent().ClipTo(content));
+			return Uncache(changed);
+		}
+
+		std::pair<const Element*, int> Pick(Pos pos) {
+			if (!Enable) return _Element::Pick(pos);
+			if (Indexed && index.Valid()) {
+				auto best = index.Pick(pos);
+				return best.first ? best : _Element::Pick(pos);
+			}
+			std::pair<const Element*, int> best = std::make_pair(nullptr, MouseTargetThreshold + 1);
+			for (auto& child : children)
+				if (child && child->Reach().Distance(pos) < best.second) {
+					auto hit = child->Pick(pos);
+					if (hit.second < best.second) best = std::make_pair(hit.first ? hit.first : &child, hit.second);
 				}
-			if (results.empty()) return _Element::MouseTarget(pos);
-			itor p = results.begin();
-			if (results.size() > 1) p = std::min_element(results.begin(), results.end(), comp);
-			if (p->second > MouseTargetThreshold) return _Element::MouseTarget(pos);
-			return *p;
+			return best.first ? best : _Element::Pick(pos);
 		}
 
 		void Measure(Size size) {
-			ActualSize = {
-				std::max(0, size.Width - Margin.Right - Margin.Left),
-				std::max(0, size.Height - Margin.Top - Margin.Bottom),
-			};
+			if (Remeasure(size))
+				ActualSize = {
+					std::max(0, size.Width - Margin.Right - Margin.Left),
+					std::max(0, size.Height - Margin.Top - Margin.Bottom),
+				};
 			for (auto& child : children) {
 				if (child) child->Measure(ActualSize);
 			}
@@ -85,16 +129,52 @@ namespace easy {
 			_Element::Arrange(base, size);
 			for (auto& child : children)
 				if (child) child->Arrange(ActualPos, ActualSize);
+			reach = Rect::BaseOn(ActualPos, ActualSize);
+			for (auto& child : children)
+				if (child) reach = reach.Hull(child->Reach());
+			if (!Indexed) return index.Invalidate();
+			index.Update(Rect::BaseOn(ActualPos, ActualSize), [this](auto&& add) {
+				for (auto& child : children)
+					if (child) add(&child);
+			});
 		}
 
-		void Render() {
-			if (!Visible) return;
-			_Element::Render();
+		void PickChildren() {
+			Renderer::PushClip(ContentClip());
 			for (auto& child : children)
-				if (child) {
-					child->BeforeRender(child, EventArgs{ EventType::BeforeRender });
-					child->Render();
+				if (child && Renderer::InClip(child->Extent())) child->ComposePick();
+			Renderer::PopClip();
+		}
+
+		void Render() {
+			if (!Visible || !Renderer::InClip(extent) || RenderLayer()) return;
+			Rect clip = Renderer::Clip().ClipTo(ContentClip());
+			auto covered = [this](Rect r) {
+				for (Rect o : occluders)
+					if (o.Contains(r)) return true;
+				return false;
+			};
+			occluders.clear();
+			occluded.assign(children.size(), false);
+			size_t index = children.size();
+			for (auto p = children.rbegin(); p != children.rend(); ++p) {
+				Element& child = *p;
+				--index;
+				if (!child) continue;
+				Rect visible = child->Extent().ClipTo(clip);
+				if (visible.Empty() || covered(visible)) {
+					occluded[index] = true;
+					continue;
 				}
+				Rect opaque = child->Opaque().ClipTo(clip);
+				if (!opaque.Empty() && Renderer::Opacity() == 0xFF) occluders.push_back(opaque);
+			}
+			if (!covered(Bounds().ClipTo(Renderer::Clip()))) _Element::Render();
+			Renderer::PushClip(clip);
+			index = 0;
+			for (auto& child : children)
+				if (!occluded[index++] && child) child->Compose();
+			Renderer::PopClip();
 		}
 
 	};
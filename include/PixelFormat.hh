@@ -0,0 +1,173 @@
+#ifndef PIXEL_FORMAT_HH_
+#define PIXEL_FORMAT_HH_
+
+#include <algorithm>
+#include "LinearType.hh"
+#include "Span.hh"
+
+namespace easy {
+
+	enum class PixelFormat {
+		BGRA8888,
+		RGBA8888,
+		RGB565,
+		BGR888
+	};
+
+	inline Color Over(Color dst, Color src) {
+		auto over = [&](uint8_t s, uint8_t d) { return static_cast<uint8_t>(std::min<unsigned>(255, s + Span::Scale(d, src.Alpha))); };
+		return Color{ 0, over(src.Red, dst.Red), over(src.Green, dst.Green), over(src.Blue, dst.Blue) };
+	}
+
+	struct FormatBGRA8888 {
+		static constexpr PixelFormat Format = PixelFormat::BGRA8888;
+		static constexpr int Bytes = 4;
+
+		static uint32_t Pack(Color c) {
+			return static_cast<uint32_t>(c.Blue) |
+				static_cast<uint32_t>(c.Green) << 8 |
+				static_cast<uint32_t>(c.Red) << 16 |
+				static_cast<uint32_t>(c.Alpha) << 24;
+		}
+
+		static void Fill(uint8_t* line, int left, int right, int y, Color c) {
+			Span::Fill(reinterpret_cast<uint32_t*>(line) + left, Pack(c), right - left);
+		}
+
+		static void Blend(uint8_t* line, int left, int right, int y, Color c) {
+			Span::Blend(reinterpret_cast<uint32_t*>(line) + left, Pack(Color{ 0, c.Red, c.Green, c.Blue }), c.Alpha, right - left);
+		}
+
+		static void Put(uint8_t* line, int x, int y, Color c) {
+			reinterpret_cast<uint32_t*>(line)[x] = Pack(c);
+		}
+	};
+
+	struct FormatRGBA8888 {
+		static constexpr PixelFormat Format = PixelFormat::RGBA8888;
+		static constexpr int Bytes = 4;
+
+		static uint32_t Pack(Color c) {
+			return static_cast<uint32_t>(c.Red) |
+				static_cast<uint32_t>(c.Green) << 8 |
+				static_cast<uint32_t>(c.Blue) << 16 |
+				static_cast<uint32_t>(c.Alpha) << 24;
+		}
+
+		static void Fill(uint8_t* line, int left, int right, int y, Color c) {
+			Span::Fill(reinterpret_cast<uint32_t*>(line) + left, Pack(c), right - left);
+		}
+
+		static void Blend(uint8_t* line, int left, int right, int y, Color c) {
+			Span::Blend(reinterpret_cast<uint32_t*>(line) + left, Pack(Color{ 0, c.Red, c.Green, c.Blue }), c.Alpha, right - left);
+		}
+
+		static void Put(uint8_t* line, int x, int y, Color c) {
+			reinterpret_cast<uint32_t*>(line)[x] = Pack(c);
+		}
+	};
+
+	struct FormatRGB565 {
+		static constexpr PixelFormat Format = PixelFormat::RGB565;
+		static constexpr int Bytes = 2;
+
+		static bool& Dithering() {
+			static bool dithering = false;
+			return dithering;
+		}
+
+		static uint16_t Pack(Color c) {
+			return static_cast<uint16_t>((c.Red >> 3) << 11 | (c.Green >> 2) << 5 | c.Blue >> 3);
+		}
+
+		static uint16_t Pack(Color c, int x, int y) {
+			static constexpr uint8_t bayer[4][4] = {
+				{ 0, 8, 2, 10 },
+				{ 12, 4, 14, 6 },
+				{ 3, 11, 1, 9 },
+				{ 15, 7, 13, 5 }
+			};
+			int d = bayer[y & 3][x & 3];
+			int r = std::min(255, c.Red + d / 2);
+			int g = std::min(255, c.Green + d / 4);
+			int b = std::min(255, c.Blue + d / 2);
+			return static_cast<uint16_t>((r >> 3) << 11 | (g >> 2) << 5 | b >> 3);
+		}
+
+		static void Fill(uint8_t* line, int left, int right, int y, Color c) {
+			uint16_t* dst = reinterpret_cast<uint16_t*>(line) + left;
+			size_t count = right - left;
+			if (Dithering()) {
+				uint16_t pattern[4] = { Pack(c, 0, y), Pack(c, 1, y), Pack(c, 2, y), Pack(c, 3, y) };
+				for (size_t i = 0; i < count; ++i) dst[i] = pattern[(left + i) & 3];
+				return;
+			}
+			uint16_t value = Pack(c);
+			if (count && (reinterpret_cast<uintptr_t>(dst) & 2)) *dst++ = value, --count;
+			Span::Fill(reinterpret_cast<uint32_t*>(dst), value | static_cast<uint32_t>(value) << 16, count / 2);
+			if (count & 1) dst[count - 1] = value;
+		}
+
+		static Color Unpack(uint16_t value) {
+			unsigned r = value >> 11, g = value >> 5 & 0x3f, b = value & 0x1f;
+			return Color{ 0, static_cast<uint8_t>(r << 3 | r >> 2), static_cast<uint8_t>(g << 2 | g >> 4), static_cast<uint8_t>(b << 3 | b >> 2) };
+		}
+
+		static void Blend(uint8_t* line, int left, int right, int y, Color c) {
+			uint16_t* dst = reinterpret_cast<uint16_t*>(line);
+			bool dithering = Dithering();
+			for (int i = left; i < right; ++i) {
+				Color blended = Over(Unpack(dst[i]), c);
+				dst[i] = dithering ? Pack(blended, i, y) : Pack(blended);
+			}
+		}
+
+		static void Put(uint8_t* line, int x, int y, Color c) {
+			reinterpret_cast<uint16_t*>(line)[x] = Dithering() ? Pack(c, x, y) : Pack(c);
+		}
+	};
+
+	struct FormatBGR888 {
+		static constexpr PixelFormat Format = PixelFormat::BGR888;
+		static constexpr int Bytes = 3;
+
+		static void Fill(uint8_t* line, int left, int right, int y, Color c) {
+			uint8_t* dst = line + left * 3;
+			for (int i = left; i < right; ++i, dst += 3) {
+				dst[0] = c.Blue;
+				dst[1] = c.Green;
+				dst[2] = c.Red;
+			}
+		}
+
+		static void Blend(uint8_t* line, int left, int right, int y, Color c) {
+			uint8_t* dst = line + left * 3;
+			for (int i = left; i < right; ++i, dst += 3) {
+				Color blended = Over(Color{ 0, dst[2], dst[1], dst[0] }, c);
+				dst[0] = blended.Blue;
+				dst[1] = blended.Green;
+				dst[2] = blended.Red;
+			}
+		}
+
+		static void Put(uint8_t* line, int x, int y, Color c) {
+			uint8_t* dst = line + x * 3;
+			dst[0] = c.Blue;
+			dst[1] = c.Green;
+			dst[2] = c.Red;
+		}
+	};
+
+	template<typename F>
+	static void WithPixelFormat(PixelFormat format, F&& f) {
+		switch (format) {
+		case PixelFormat::RGBA8888: return f(FormatRGBA8888{});
+		case PixelFormat::RGB565: return f(FormatRGB565{});
+		case PixelFormat::BGR888: return f(FormatBGR888{});
+		default: return f(FormatBGRA8888{});
+		}
+	}
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef RASTER_POOL_HH_
+#define RASTER_POOL_HH_
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace easy {
+
+	struct RasterPool {
+	protected:
+		std::vector<std::thread> workers;
+		std::mutex mutex;
+		std::condition_variable wake, idle;
+		std::function<void()> job;
+		unsigned long long generation = 0;
+		size_t busy = 0;
+		bool stopping = false;
+
+		void Work() {
+			unsigned long long seen = 0;
+			std::unique_lock<std::mutex> lock(mutex);
+			while (true) {
+				wake.wait(lock, [&]() { return stopping || generation != seen; });
+				if (stopping) return;
+				seen = generation;
+				lock.unlock();
+				job();
+				lock.lock();
+				if (--busy == 0) idle.notify_one();
+			}
+		}
+
+	public:
+		explicit RasterPool(unsigned threads) {
+			for (unsigned i = 1; i < threads; ++i)
+				workers.emplace_back([this]() { Work(); });
+		}
+
+		~RasterPool() {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto& worker : workers) worker.join();
+		}
+
+		unsigned Threads() const {
+			return static_cast<unsigned>(workers.size()) + 1;
+		}
+
+		void Run(const std::function<void()>& f) {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				job = f;
+				busy = workers.size();
+				++generation;
+			}
+			wake.notify_all();
+			f();
+			std::unique_lock<std::mutex> lock(mutex);
+			idle.wait(lock, [&]() { return busy == 0; });
+		}
+
+		static RasterPool& Instance(unsigned threads) {
+			static std::unique_ptr<RasterPool> pool;
+			if (!pool || pool->Threads() != threads) pool.reset(new RasterPool(threads));
+			return *pool;
+		}
+	};
+
+}
+
+#endif
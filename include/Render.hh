@@ -2,15 +2,91 @@
 #define RENDER_HH_
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "DisplayList.hh"
 #include "LinearType.hh"
+#include "PixelFormat.hh"
+#include "RasterPool.hh"
 #include "Timer.hh"
 
 namespace easy {
 
+	struct FrameStats {
+		unsigned long long Frames = 0;
+		unsigned long long Presented = 0;
+		unsigned long long MissedVBlanks = 0;
+		unsigned long long PresentedBytes = 0;
+		std::chrono::steady_clock::duration PresentTime = {};
+
+		double PresentBandwidth() const {
+			double seconds = std::chrono::duration<double>(PresentTime).count();
+			return seconds > 0 ? PresentedBytes / seconds / 1e6 : 0;
+		}
+	};
+
+	struct FrameScheduler {
+		using Clock = std::chrono::steady_clock;
+
+		Clock::duration refresh = {};
+		Clock::duration period = {};
+		Clock::time_point next = Clock::now();
+		Clock::time_point target = {};
+		FrameStats& stats;
+
+		FrameScheduler(double FPS, double refresh_rate, FrameStats& stats) : stats(stats) {
+			if (refresh_rate > 0) {
+				refresh = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1 / refresh_rate));
+				period = refresh * std::max(1, static_cast<int>(refresh_rate / FPS + 0.5));
+			} else {
+				period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1 / FPS));
+			}
+		}
+
+		bool Due(Clock::time_point now) const {
+			return now >= next;
+		}
+
+		void Idle(Clock::time_point now) {
+			if (next < now) next = now;
+		}
+
+		void Advance(Clock::time_point now) {
+			auto skipped = (now - next) / period;
+			stats.MissedVBlanks += skipped * (refresh.count() ? period / refresh : 1);
+			++stats.Frames;
+			target = next + period * skipped + refresh;
+			next += period * (skipped + 1);
+		}
+
+		void Synchronized(Clock::time_point vblank) {
+			if (!refresh.count()) return;
+			auto late = (vblank - target + refresh / 2) / refresh;
+			if (late > 0) stats.MissedVBlanks += late;
+			next = vblank + period - refresh;
+		}
+	};
 
 	struct Renderer {
+		static constexpr size_t MaxDamagedRects = 8;
+		static constexpr int TileSize = 64;
+
 		static void Render() {
+			auto damage = RegisterDamage(nullptr);
+			std::vector<Rect> presented;
+			presented.swap(Damaged());
+			for (Rect r : presented)
+				damage(r.Left, r.Top, r.Right, r.Bottom);
+			if (RegisterWaitVSync(nullptr)()) VBlank() = std::chrono::steady_clock::now();
+			auto begin = std::chrono::steady_clock::now();
 			RegisterRender(nullptr)();
+			Stats().PresentTime += std::chrono::steady_clock::now() - begin;
+			Stats().PresentedBytes += RegisterPresented(nullptr)();
+			++Stats().Presented;
+			if (RegisterBuffers(nullptr)() > 1)
+				for (Rect r : presented) Damage(r);
 		}
 
 		static bool& Invalidated() {
@@ -23,11 +99,51 @@ namespace easy {
 			return instance;
 		}
 
+		static auto RegisterFormat(int (*setter)()) -> int(*)() {
+			static auto instance = setter;
+			return instance;
+		}
+
+		static auto RegisterStride(int (*setter)()) -> int(*)() {
+			static auto instance = setter;
+			return instance;
+		}
+
 		static auto RegisterRender(void (*setter)()) -> void(*)() {
 			static auto instance = setter;
 			return instance;
 		}
 
+		static auto RegisterDamage(void (*setter)(int, int, int, int)) -> void(*)(int, int, int, int) {
+			static auto instance = setter;
+			return instance;
+		}
+
+		static auto RegisterBuffers(int (*setter)()) -> int(*)() {
+			static auto instance = setter;
+			return instance;
+		}
+
+		static auto RegisterWaitVSync(bool (*setter)()) -> bool(*)() {
+			static auto instance = setter;
+			return instance;
+		}
+
+		static auto RegisterPresented(long long (*setter)()) -> long long(*)() {
+			static auto instance = setter;
+			return instance;
+		}
+
+		static auto RegisterRefreshRate(double (*setter)()) -> double(*)() {
+			static auto instance = setter;
+			return instance;
+		}
+
+		static auto RegisterWait(void (*setter)(long long)) -> void(*)(long long) {
+			static auto instance = setter;
+			return instance;
+		}
+
 		static auto RegisterMouseClick(int* (*setter)()) -> int*(*)() {
 			static auto instance = setter;
 			return instance;
@@ -47,12 +163,136 @@ namespace easy {
 			else m_height = height;
 		}
 
-		
+		static void Wait(bool timed, std::chrono::steady_clock::time_point deadline) {
+			long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+			RegisterWait(nullptr)(timed ? std::max(0LL, ns) : -1);
+		}
+
+		static double RefreshRate() {
+			return RegisterRefreshRate(nullptr)();
+		}
+
+		static std::chrono::steady_clock::time_point& VBlank() {
+			static std::chrono::steady_clock::time_point vblank = {};
+			return vblank;
+		}
+
+		static FrameStats& Stats() {
+			static FrameStats stats;
+			return stats;
+		}
+
+		static Rect Screen() {
+			Size size = {};
+			RegisterSize(size.Width, size.Height);
+			return Rect::BaseOn({ 0, 0 }, size);
+		}
+
+		static uint8_t& Opacity() {
+			static uint8_t opacity = 0xFF;
+			return opacity;
+		}
+
+		static bool& Picking() {
+			static bool picking = false;
+			return picking;
+		}
+
+		static std::vector<uint32_t>& PickBuffer() {
+			static std::vector<uint32_t> buffer;
+			return buffer;
+		}
+
+		static uint32_t& PickId() {
+			static uint32_t id = 0;
+			return id;
+		}
+
+		static bool& PickBlocked() {
+			static bool blocked = false;
+			return blocked;
+		}
+
+		static Color Premultiply(Color c) {
+			uint8_t coverage = Span::Scale(0xFF - c.Alpha, Opacity());
+			if (coverage == 0xFF) return c;
+			return Color{
+				static_cast<uint8_t>(0xFF - coverage),
+				Span::Scale(c.Red, coverage),
+				Span::Scale(c.Green, coverage),
+				Span::Scale(c.Blue, coverage)
+			};
+		}
+
+		static Rect& Clip() {
+			static Rect clip = { 0, 0, std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+			return clip;
+		}
+
+		static std::vector<Rect>& ClipStack() {
+			static std::vector<Rect> stack;
+			return stack;
+		}
+
+		static void PushClip(Rect r) {
+			ClipStack().push_back(Clip());
+			Clip() = Clip().ClipTo(r);
+		}
+
+		static void PopClip() {
+			Clip() = ClipStack().back();
+			ClipStack().pop_back();
+		}
+
+		static bool InClip(Rect r) {
+			return r.Intersects(Clip());
+		}
+
+		static std::vector<Rect>& Damaged() {
+			static std::vector<Rect> damaged;
+			return damaged;
+		}
+
+		static void Damage(Rect r) {
+			r = r.ClipTo(Screen());
+			if (r.Empty()) return;
+			auto& damaged = Damaged();
+			for (auto itor = damaged.begin(); itor != damaged.end();) {
+				if (itor->Contains(r)) return;
+				if (itor->Intersects(r)) {
+					r = r.Union(*itor);
+					damaged.erase(itor);
+					itor = damaged.begin();
+				} else itor++;
+			}
+			if (damaged.size() < MaxDamagedRects) return damaged.push_back(r);
+			for (Rect d : damaged) r = r.Union(d);
+			damaged.assign(1, r);
+		}
 
 		static uint8_t* Data() {
 			return RegisterData(nullptr)();
 		}
 
+		static PixelFormat Format() {
+			return static_cast<PixelFormat>(RegisterFormat(nullptr)());
+		}
+
+		static size_t Stride() {
+			return static_cast<size_t>(RegisterStride(nullptr)());
+		}
+
+		static RenderTarget*& Target() {
+			static RenderTarget* target = nullptr;
+			return target;
+		}
+
+		static RenderTarget Current() {
+			if (Target()) return *Target();
+			uint32_t* pick = Picking() && !PickBuffer().empty() ? PickBuffer().data() : nullptr;
+			return { Data(), Stride(), Format(), Screen(), nullptr, pick };
+		}
+
 		static void FillPixel(uint8_t* data, Color c) {
 			data[0] = c.Blue;
 			data[1] = c.Green;
@@ -60,57 +300,225 @@ namespace easy {
 			data[3] = c.Alpha;
 		}
 
-		static void DrawFilledRect(Rect r, Color c) {
-			Size size = {};
-			RegisterSize(size.Width, size.Height);
-			Rect t = r.ClipTo(size);
-			if (t.Left >= t.Right || t.Top >= t.Bottom) return;
-			uint8_t* data = Data();
-			size_t line_size = size.Width * size_t(4);
-			for (int i = t.Left; i < t.Right; ++i) {
-				for (int j = t.Top; j < t.Bottom; ++j) {
-					FillPixel(data + (j * line_size + i * size_t(4)), c);
-				}
+		static DisplayList*& List() {
+			static DisplayList* list = nullptr;
+			return list;
+		}
+
+		static DisplayList& Frame() {
+			static DisplayList list;
+			return list;
+		}
+
+		static bool Recording() {
+			return List() && !Target();
+		}
+
+		template<typename T>
+		static void Record(Rect bounds, const T& op) {
+			Rect clip = Screen().ClipTo(Clip());
+			bounds = bounds.ClipTo(clip);
+			if (bounds.Empty()) return;
+			List()->Commands.push_back({ clip, bounds, op });
+		}
+
+		static unsigned& RasterThreads() {
+			static unsigned threads = 1;
+			return threads;
+		}
+
+		static void Execute(const DisplayList& list, const RenderTarget& target, Rect tile) {
+			for (const DrawCommand& command : list.Commands) {
+				if (!command.Bounds.Intersects(tile)) continue;
+				Rect clip = command.Clip.ClipTo(tile);
+				std::visit([&](const auto& op) { Raster(target, clip, op); }, command.Op);
 			}
 		}
 
+		static void Execute(const DisplayList& list) {
+			RenderTarget target = Current();
+			if (RasterThreads() > 1) return ExecuteTiled(list, target);
+			Execute(list, target, target.Area);
+		}
+
+		static void ExecuteTiled(const DisplayList& list, const RenderTarget& target) {
+			static std::vector<std::vector<uint32_t>> bins;
+			static std::vector<uint32_t> tiles;
+			Rect area = target.Area;
+			int columns = (area.Right - area.Left + TileSize - 1) / TileSize;
+			int rows = (area.Bottom - area.Top + TileSize - 1) / TileSize;
+			bins.resize(static_cast<size_t>(columns) * rows);
+			for (auto& bin : bins) bin.clear();
+			for (uint32_t i = 0; i < list.Commands.size(); ++i) {
+				Rect b = list.Commands[i].Bounds.ClipTo(area);
+				if (b.Empty()) continue;
+				for (int y = (b.Top - area.Top) / TileSize; y <= (b.Bottom - 1 - area.Top) / TileSize; ++y)
+					for (int x = (b.Left - area.Left) / TileSize; x <= (b.Right - 1 - area.Left) / TileSize; ++x)
+						bins[y * columns + x].push_back(i);
+			}
+			tiles.clear();
+			for (uint32_t t = 0; t < bins.size(); ++t)
+				if (!bins[t].empty()) tiles.push_back(t);
+			if (tiles.size() < 2) return Execute(list, target, area);
+			std::atomic<size_t> next(0);
+			RasterPool::Instance(RasterThreads()).Run([&]() {
+				for (size_t k; (k = next++) < tiles.size();) {
+					int x = tiles[k] % columns, y = tiles[k] / columns;
+					Rect tile = Rect::BaseOn({ area.Left + x * TileSize, area.Top + y * TileSize }, { TileSize, TileSize }).ClipTo(area);
+					for (uint32_t i : bins[tiles[k]]) {
+						const DrawCommand& command = list.Commands[i];
+						Rect clip = command.Clip.ClipTo(tile);
+						std::visit([&](const auto& op) { Raster(target, clip, op); }, command.Op);
+					}
+				}
+			});
+		}
+
+		static void DrawFilledRect(Rect r, Color c) {
+			c = Premultiply(c);
+			if (c.Alpha == 0xFF) return;
+			FillCommand op = { r, c };
+			if (Recording()) return Record(r, op);
+			Raster(Current(), Clip(), op);
+		}
+
+		static void Clear(Rect r, Rect keep) {
+			keep = keep.ClipTo(r);
+			if (keep.Empty()) return DrawFilledRect(r, Color{});
+			DrawFilledRect({ r.Left, r.Top, r.Right, keep.Top }, Color{});
+			DrawFilledRect({ r.Left, keep.Top, keep.Left, keep.Bottom }, Color{});
+			DrawFilledRect({ keep.Right, keep.Top, r.Right, keep.Bottom }, Color{});
+			DrawFilledRect({ r.Left, keep.Bottom, r.Right, r.Bottom }, Color{});
+		}
+
 		static void DrawRect(Rect r, Color c, Rect thickness) {
 			if (!thickness.Left && !thickness.Right && !thickness.Top && !thickness.Bottom)
 				return;
+			c = Premultiply(c);
+			if (c.Alpha == 0xFF) return;
+			BorderCommand op = { r, thickness, c };
+			if (Recording())
+				return Record({ r.Left - thickness.Left, r.Top - thickness.Top, r.Right + thickness.Right, r.Bottom + thickness.Bottom }, op);
+			Raster(Current(), Clip(), op);
+		}
+
+		static void DrawSpans(Pos origin, Color c, const GlyphSpan* spans, size_t count) {
+			c = Premultiply(c);
+			if (c.Alpha == 0xFF) return;
+			SpansCommand op = { origin, c, spans, count };
+			if (Recording()) {
+				Rect bounds = {};
+				for (size_t i = 0; i < count; ++i)
+					bounds = bounds.Union({ origin.X + spans[i].Left, origin.Y + spans[i].Top, origin.X + spans[i].Right, origin.Y + spans[i].Bottom });
+				return Record(bounds, op);
+			}
+			Raster(Current(), Clip(), op);
+		}
+
+		static void DrawPick(Rect r, uint32_t id) {
+			PickCommand op = { r, id };
+			if (Recording()) return Record(r, op);
+			Raster(Current(), Clip(), op);
+		}
+
+		static void DrawBlit(const RenderTarget& source, const std::vector<Rect>& runs) {
+			BlitCommand op = { &source, &runs };
+			if (Recording()) return Record(source.Area, op);
+			Raster(Current(), Clip(), op);
+		}
+
+		static void Raster(const RenderTarget& target, Rect clip, const FillCommand& op) {
+			Rect t = op.Area.ClipTo(target.Area).ClipTo(clip);
+			if (t.Empty()) return;
+			Pos origin = { target.Area.Left, target.Area.Top };
+			WithPixelFormat(target.Format, [&](auto format) {
+				using F = decltype(format);
+				for (int j = t.Top; j < t.Bottom; ++j)
+					Paint<F>(target.Line(j), t.Left - origin.X, t.Right - origin.X, j - origin.Y, op.Fill);
+			});
+			if (!target.Coverage) return;
+			size_t width = target.Area.Right - target.Area.Left;
+			for (int j = t.Top; j < t.Bottom; ++j)
+				std::fill_n(target.Coverage + (j - origin.Y) * width + (t.Left - origin.X), t.Right - t.Left, Covered(op.Fill));
+		}
+
+		static void Raster(const RenderTarget& target, Rect clip, const PickCommand& op) {
+			if (!target.Pick) return;
+			Rect t = op.Area.ClipTo(target.Area).ClipTo(clip);
+			if (t.Empty()) return;
+			size_t width = target.Area.Right - target.Area.Left;
+			for (int j = t.Top; j < t.Bottom; ++j)
+				Span::Fill(target.Pick + (j - target.Area.Top) * width + (t.Left - target.Area.Left), op.Id, t.Right - t.Left);
+		}
+
+		static void Raster(const RenderTarget& target, Rect clip, const BorderCommand& op) {
+			Rect r = op.Area, thickness = op.Thickness;
 			Rect border = {
 				r.Left - thickness.Left,
 				r.Top - thickness.Top,
 				r.Right + thickness.Right,
 				r.Bottom + thickness.Bottom
 			};
-			Size size = {};
-			RegisterSize(size.Width, size.Height);
-			Rect t = r.ClipTo(size);
-			border = border.ClipTo(size);
-			if (t.Left >= t.Right || t.Top >= t.Bottom) return;
-			DrawFilledRect({ border.Left, border.Top, t.Left, border.Bottom }, c);
-			DrawFilledRect({ t.Right, border.Top, border.Right, border.Bottom }, c);
-			DrawFilledRect({ border.Left, t.Bottom, border.Right, border.Bottom }, c);
-			DrawFilledRect({ border.Left, border.Top, border.Right, t.Top }, c);
+			Rect t = r.ClipTo(target.Area);
+			border = border.ClipTo(target.Area);
+			if (t.Empty()) return;
+			Raster(target, clip, FillCommand{ { border.Left, border.Top, t.Left, border.Bottom }, op.Fill });
+			Raster(target, clip, FillCommand{ { t.Right, border.Top, border.Right, border.Bottom }, op.Fill });
+			Raster(target, clip, FillCommand{ { border.Left, t.Bottom, border.Right, border.Bottom }, op.Fill });
+			Raster(target, clip, FillCommand{ { border.Left, border.Top, border.Right, t.Top }, op.Fill });
 		}
 
-		static void DrawByMask(Rect r, Color c, const uint8_t* mask, Size shape) {
-			Size size = {};
-			RegisterSize(size.Width, size.Height);
-			Rect t = r.ClipTo(size);
-			if (t.Left >= t.Right || t.Top >= t.Bottom) return;
-			uint8_t* data = Data();
-			size_t line_size = size.Width * size_t(4);
-			for (int i = t.Left; i < t.Right && i < t.Left + shape.Width; ++i) {
-				for (int j = t.Top; j < t.Bottom && j < t.Top + shape.Height; ++j) {
-					int index = (i - t.Left) + (j - t.Top) * ((shape.Width + 7) / 8 * 8);
-					if ((mask[index / 8] >> (7 - (index % 8))) & 0x1) {
-						FillPixel(data + (j * line_size + i * size_t(4)), c);
+		static void Raster(const RenderTarget& target, Rect clip, const SpansCommand& op) {
+			clip = target.Area.ClipTo(clip);
+			Pos origin = op.Origin;
+			Pos base = { target.Area.Left, target.Area.Top };
+			size_t width = target.Area.Right - target.Area.Left;
+			WithPixelFormat(target.Format, [&](auto format) {
+				using F = decltype(format);
+				for (size_t i = 0; i < op.Count; ++i) {
+					const GlyphSpan& s = op.Spans[i];
+					Rect t = Rect{ origin.X + s.Left, origin.Y + s.Top, origin.X + s.Right, origin.Y + s.Bottom }.ClipTo(clip);
+					if (t.Empty()) continue;
+					for (int j = t.Top; j < t.Bottom; ++j) {
+						Paint<F>(target.Line(j), t.Left - base.X, t.Right - base.X, j - base.Y, op.Fill);
+						if (target.Coverage)
+							std::fill_n(target.Coverage + (j - base.Y) * width + (t.Left - base.X), t.Right - t.Left, Covered(op.Fill));
 					}
 				}
+			});
+		}
+
+		static void Raster(const RenderTarget& target, Rect clip, const BlitCommand& op) {
+			const RenderTarget& source = *op.Source;
+			clip = target.Area.ClipTo(clip);
+			if (!clip.Intersects(source.Area)) return;
+			int bytes = 4;
+			WithPixelFormat(target.Format, [&](auto format) { bytes = decltype(format)::Bytes; });
+			size_t width = target.Area.Right - target.Area.Left;
+			for (Rect run : *op.Runs) {
+				if (run.Top < clip.Top) continue;
+				if (run.Top >= clip.Bottom) break;
+				run = run.ClipTo(clip);
+				if (run.Empty()) continue;
+				uint8_t* dst = target.Line(run.Top) + (run.Left - target.Area.Left) * bytes;
+				const uint8_t* src = source.Line(run.Top) + (run.Left - source.Area.Left) * bytes;
+				if (bytes == 4) Span::Copy(reinterpret_cast<uint32_t*>(dst), reinterpret_cast<const uint32_t*>(src), run.Right - run.Left);
+				else memcpy(dst, src, static_cast<size_t>(run.Right - run.Left) * bytes);
+				if (target.Coverage)
+					memset(target.Coverage + (run.Top - target.Area.Top) * width + (run.Left - target.Area.Left), 1, run.Right - run.Left);
 			}
 		}
 
+		template<typename F>
+		static void Paint(uint8_t* line, int left, int right, int y, Color c) {
+			if (c.Alpha) F::Blend(line, left, right, y, c);
+			else F::Fill(line, left, right, y, c);
+		}
+
+		static uint8_t Covered(Color c) {
+			return c.Alpha ? 2 : 1;
+		}
+
 		template<typename T>
 		static void MainLoop(T root, double FPS = 40.0);
 	};
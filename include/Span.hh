@@ -0,0 +1,491 @@
+#ifndef SPAN_HH_
+#define SPAN_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define EASY_SPAN_NEON
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define EASY_SPAN_SSE2
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define EASY_SPAN_AVX2
+#define EASY_SPAN_AVX2_TARGET
+#elif defined(EASY_SPAN_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define EASY_SPAN_AVX2
+#define EASY_SPAN_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace easy {
+
+	struct SpanKernels {
+		const char* Name;
+		void (*Fill)(uint32_t* dst, uint32_t value, size_t count);
+		void (*Copy)(uint32_t* dst, const uint32_t* src, size_t count);
+		void (*Stream)(uint8_t* dst, const uint8_t* src, size_t bytes);
+		void (*Blend)(uint32_t* dst, uint32_t value, uint8_t alpha, size_t count);
+		void (*Lerp)(uint32_t* dst, const uint32_t* from, const uint32_t* to, uint8_t t, size_t count);
+		void (*Scale)(uint32_t* dst, const uint32_t* src, uint8_t k, size_t count);
+	};
+
+	struct SpanScalar {
+		static constexpr const char* Name = "scalar";
+
+		static bool Supported() {
+			return true;
+		}
+
+		static uint8_t Div255(unsigned x) {
+			x += 128;
+			return static_cast<uint8_t>((x + (x >> 8)) >> 8);
+		}
+
+		static size_t Head(const uint8_t* dst, size_t bytes) {
+			return std::min(bytes, static_cast<size_t>(-reinterpret_cast<uintptr_t>(dst) & 63));
+		}
+
+		static uint32_t Blend(uint32_t dst, uint32_t value, uint8_t alpha) {
+			uint32_t result = 0;
+			for (int shift = 0; shift < 32; shift += 8)
+				result |= static_cast<uint32_t>(std::min(255u, (value >> shift & 0xFF) + Div255((dst >> shift & 0xFF) * alpha))) << shift;
+			return result;
+		}
+
+		static uint32_t Lerp(uint32_t from, uint32_t to, uint8_t t) {
+			uint32_t result = 0;
+			for (int shift = 0; shift < 32; shift += 8)
+				result |= static_cast<uint32_t>(Div255((from >> shift & 0xFF) * (255u - t) + (to >> shift & 0xFF) * t)) << shift;
+			return result;
+		}
+
+		static uint32_t Scale(uint32_t src, uint8_t k) {
+			uint32_t result = 0;
+			for (int shift = 0; shift < 32; shift += 8)
+				result |= static_cast<uint32_t>(Div255((src >> shift & 0xFF) * k)) << shift;
+			return result;
+		}
+
+		static void Fill(uint32_t* dst, uint32_t value, size_t count) {
+			for (size_t i = 0; i < count; ++i) dst[i] = value;
+		}
+
+		static void Copy(uint32_t* dst, const uint32_t* src, size_t count) {
+			memcpy(dst, src, count * 4);
+		}
+
+		static void Stream(uint8_t* dst, const uint8_t* src, size_t bytes) {
+			memcpy(dst, src, bytes);
+		}
+
+		static void Blend(uint32_t* dst, uint32_t value, uint8_t alpha, size_t count) {
+			for (size_t i = 0; i < count; ++i) dst[i] = Blend(dst[i], value, alpha);
+		}
+
+		static void Lerp(uint32_t* dst, const uint32_t* from, const uint32_t* to, uint8_t t, size_t count) {
+			for (size_t i = 0; i < count; ++i) dst[i] = Lerp(from[i], to[i], t);
+		}
+
+		static void Scale(uint32_t* dst, const uint32_t* src, uint8_t k, size_t count) {
+			for (size_t i = 0; i < count; ++i) dst[i] = Scale(src[i], k);
+		}
+	};
+
+#if defined(EASY_SPAN_NEON)
+	struct SpanNEON {
+		static constexpr const char* Name = "neon";
+
+		static bool Supported() {
+			return true;
+		}
+
+		static uint8x8_t Div255(uint16x8_t x) {
+			return vraddhn_u16(x, vrshrq_n_u16(x, 8));
+		}
+
+		static void Fill(uint32_t* dst, uint32_t value, size_t count) {
+			size_t i = 0;
+			uint32x4_t v = vdupq_n_u32(value);
+			for (; i + 16 <= count; i += 16) {
+				vst1q_u32(dst + i, v);
+				vst1q_u32(dst + i + 4, v);
+				vst1q_u32(dst + i + 8, v);
+				vst1q_u32(dst + i + 12, v);
+			}
+			for (; i + 4 <= count; i += 4) vst1q_u32(dst + i, v);
+			for (; i < count; ++i) dst[i] = value;
+		}
+
+		static void Copy(uint32_t* dst, const uint32_t* src, size_t count) {
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				uint32x4_t a = vld1q_u32(src + i), b = vld1q_u32(src + i + 4);
+				vst1q_u32(dst + i, a);
+				vst1q_u32(dst + i + 4, b);
+			}
+			for (; i < count; ++i) dst[i] = src[i];
+		}
+
+		static void Stream(uint8_t* dst, const uint8_t* src, size_t bytes) {
+			size_t head = SpanScalar::Head(dst, bytes);
+			memcpy(dst, src, head);
+			dst += head, src += head, bytes -= head;
+			size_t body = bytes & ~static_cast<size_t>(63);
+			for (size_t i = 0; i < body; i += 64) {
+				uint8x16_t a = vld1q_u8(src + i), b = vld1q_u8(src + i + 16);
+				uint8x16_t c = vld1q_u8(src + i + 32), d = vld1q_u8(src + i + 48);
+				vst1q_u8(dst + i, a);
+				vst1q_u8(dst + i + 16, b);
+				vst1q_u8(dst + i + 32, c);
+				vst1q_u8(dst + i + 48, d);
+			}
+			memcpy(dst + body, src + body, bytes - body);
+		}
+
+		static void Blend(uint32_t* dst, uint32_t value, uint8_t alpha, size_t count) {
+			size_t i = 0;
+			uint8x8_t a = vdup_n_u8(alpha);
+			uint8x16_t v = vreinterpretq_u8_u32(vdupq_n_u32(value));
+			for (; i + 4 <= count; i += 4) {
+				uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + i));
+				uint8x16_t scaled = vcombine_u8(Div255(vmull_u8(vget_low_u8(d), a)), Div255(vmull_u8(vget_high_u8(d), a)));
+				vst1q_u32(dst + i, vreinterpretq_u32_u8(vqaddq_u8(scaled, v)));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Blend(dst[i], value, alpha);
+		}
+
+		static void Lerp(uint32_t* dst, const uint32_t* from, const uint32_t* to, uint8_t t, size_t count) {
+			size_t i = 0;
+			uint8x8_t u = vdup_n_u8(255 - t), w = vdup_n_u8(t);
+			for (; i + 4 <= count; i += 4) {
+				uint8x16_t a = vreinterpretq_u8_u32(vld1q_u32(from + i));
+				uint8x16_t b = vreinterpretq_u8_u32(vld1q_u32(to + i));
+				uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(a), u), vget_low_u8(b), w);
+				uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(a), u), vget_high_u8(b), w);
+				vst1q_u32(dst + i, vreinterpretq_u32_u8(vcombine_u8(Div255(lo), Div255(hi))));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Lerp(from[i], to[i], t);
+		}
+
+		static void Scale(uint32_t* dst, const uint32_t* src, uint8_t k, size_t count) {
+			size_t i = 0;
+			uint8x8_t w = vdup_n_u8(k);
+			for (; i + 4 <= count; i += 4) {
+				uint8x16_t s = vreinterpretq_u8_u32(vld1q_u32(src + i));
+				uint8x16_t scaled = vcombine_u8(Div255(vmull_u8(vget_low_u8(s), w)), Div255(vmull_u8(vget_high_u8(s), w)));
+				vst1q_u32(dst + i, vreinterpretq_u32_u8(scaled));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Scale(src[i], k);
+		}
+	};
+#endif
+
+#if defined(EASY_SPAN_SSE2)
+	struct SpanSSE2 {
+		static constexpr const char* Name = "sse2";
+
+		static bool Supported() {
+			return true;
+		}
+
+		static __m128i Div255(__m128i x) {
+			x = _mm_add_epi16(x, _mm_set1_epi16(128));
+			return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+		}
+
+		static void Fill(uint32_t* dst, uint32_t value, size_t count) {
+			size_t i = 0;
+			__m128i v = _mm_set1_epi32(static_cast<int>(value));
+			for (; i + 16 <= count; i += 16) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4), v);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), v);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 12), v);
+			}
+			for (; i + 4 <= count; i += 4) _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+			for (; i < count; ++i) dst[i] = value;
+		}
+
+		static void Copy(uint32_t* dst, const uint32_t* src, size_t count) {
+			SpanScalar::Copy(dst, src, count);
+		}
+
+		static void Stream(uint8_t* dst, const uint8_t* src, size_t bytes) {
+			size_t head = SpanScalar::Head(dst, bytes);
+			memcpy(dst, src, head);
+			dst += head, src += head, bytes -= head;
+			size_t body = bytes & ~static_cast<size_t>(63);
+			for (size_t i = 0; i < body; i += 64) {
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+				__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+				__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), a);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16), b);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 32), c);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 48), d);
+			}
+			memcpy(dst + body, src + body, bytes - body);
+		}
+
+		static void Blend(uint32_t* dst, uint32_t value, uint8_t alpha, size_t count) {
+			size_t i = 0;
+			__m128i zero = _mm_setzero_si128();
+			__m128i a = _mm_set1_epi16(alpha), v = _mm_set1_epi32(static_cast<int>(value));
+			for (; i + 4 <= count; i += 4) {
+				__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+				__m128i lo = Div255(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), a));
+				__m128i hi = Div255(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), a));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epu8(_mm_packus_epi16(lo, hi), v));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Blend(dst[i], value, alpha);
+		}
+
+		static void Lerp(uint32_t* dst, const uint32_t* from, const uint32_t* to, uint8_t t, size_t count) {
+			size_t i = 0;
+			__m128i zero = _mm_setzero_si128();
+			__m128i u = _mm_set1_epi16(255 - t), w = _mm_set1_epi16(t);
+			for (; i + 4 <= count; i += 4) {
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + i));
+				__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), u), _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), w));
+				__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), u), _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), w));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(Div255(lo), Div255(hi)));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Lerp(from[i], to[i], t);
+		}
+
+		static void Scale(uint32_t* dst, const uint32_t* src, uint8_t k, size_t count) {
+			size_t i = 0;
+			__m128i zero = _mm_setzero_si128();
+			__m128i w = _mm_set1_epi16(k);
+			for (; i + 4 <= count; i += 4) {
+				__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128i lo = Div255(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), w));
+				__m128i hi = Div255(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), w));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Scale(src[i], k);
+		}
+	};
+#endif
+
+#if defined(EASY_SPAN_AVX2)
+	struct SpanAVX2 {
+		static constexpr const char* Name = "avx2";
+
+		static bool Supported() {
+#if defined(__AVX2__)
+			return true;
+#else
+			return __builtin_cpu_supports("avx2");
+#endif
+		}
+
+		EASY_SPAN_AVX2_TARGET static __m256i Div255(__m256i x) {
+			x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+			return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+		}
+
+		EASY_SPAN_AVX2_TARGET static void Fill(uint32_t* dst, uint32_t value, size_t count) {
+			size_t i = 0;
+			__m256i v = _mm256_set1_epi32(static_cast<int>(value));
+			for (; i + 32 <= count; i += 32) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 8), v);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 16), v);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 24), v);
+			}
+			for (; i + 8 <= count; i += 8) _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+			for (; i < count; ++i) dst[i] = value;
+		}
+
+		static void Copy(uint32_t* dst, const uint32_t* src, size_t count) {
+			SpanScalar::Copy(dst, src, count);
+		}
+
+		EASY_SPAN_AVX2_TARGET static void Stream(uint8_t* dst, const uint8_t* src, size_t bytes) {
+			size_t head = SpanScalar::Head(dst, bytes);
+			memcpy(dst, src, head);
+			dst += head, src += head, bytes -= head;
+			size_t body = bytes & ~static_cast<size_t>(63);
+			for (size_t i = 0; i < body; i += 64) {
+				__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), a);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 32), b);
+			}
+			memcpy(dst + body, src + body, bytes - body);
+		}
+
+		EASY_SPAN_AVX2_TARGET static void Blend(uint32_t* dst, uint32_t value, uint8_t alpha, size_t count) {
+			size_t i = 0;
+			__m256i zero = _mm256_setzero_si256();
+			__m256i a = _mm256_set1_epi16(alpha), v = _mm256_set1_epi32(static_cast<int>(value));
+			for (; i + 8 <= count; i += 8) {
+				__m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+				__m256i lo = Div255(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), a));
+				__m256i hi = Div255(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), a));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epu8(_mm256_packus_epi16(lo, hi), v));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Blend(dst[i], value, alpha);
+		}
+
+		EASY_SPAN_AVX2_TARGET static void Lerp(uint32_t* dst, const uint32_t* from, const uint32_t* to, uint8_t t, size_t count) {
+			size_t i = 0;
+			__m256i zero = _mm256_setzero_si256();
+			__m256i u = _mm256_set1_epi16(255 - t), w = _mm256_set1_epi16(t);
+			for (; i + 8 <= count; i += 8) {
+				__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i));
+				__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(to + i));
+				__m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), u), _mm256_mullo_epi16(_mm256_unpacklo_epi8(b, zero), w));
+				__m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), u), _mm256_mullo_epi16(_mm256_unpackhi_epi8(b, zero), w));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(Div255(lo), Div255(hi)));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Lerp(from[i], to[i], t);
+		}
+
+		EASY_SPAN_AVX2_TARGET static void Scale(uint32_t* dst, const uint32_t* src, uint8_t k, size_t count) {
+			size_t i = 0;
+			__m256i zero = _mm256_setzero_si256();
+			__m256i w = _mm256_set1_epi16(k);
+			for (; i + 8 <= count; i += 8) {
+				__m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i lo = Div255(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), w));
+				__m256i hi = Div255(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), w));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_packus_epi16(lo, hi));
+			}
+			for (; i < count; ++i) dst[i] = SpanScalar::Scale(src[i], k);
+		}
+	};
+#endif
+
+	struct Span {
+
+		template<typename K>
+		static SpanKernels Table() {
+			return { K::Name, K::Fill, K::Copy, K::Stream, K::Blend, K::Lerp, K::Scale };
+		}
+
+		static const std::vector<SpanKernels>& Variants() {
+			static const std::vector<SpanKernels> variants = []() {
+				std::vector<SpanKernels> supported = { Table<SpanScalar>() };
+#if defined(EASY_SPAN_NEON)
+				if (SpanNEON::Supported()) supported.push_back(Table<SpanNEON>());
+#endif
+#if defined(EASY_SPAN_SSE2)
+				if (SpanSSE2::Supported()) supported.push_back(Table<SpanSSE2>());
+#endif
+#if defined(EASY_SPAN_AVX2)
+				if (SpanAVX2::Supported()) supported.push_back(Table<SpanAVX2>());
+#endif
+				return supported;
+			}();
+			return variants;
+		}
+
+		static const SpanKernels& Kernels() {
+			static const SpanKernels& kernels = []() -> const SpanKernels& {
+				const std::vector<SpanKernels>& variants = Variants();
+				if (const char* name = getenv("EASY_SPAN"))
+					for (const SpanKernels& k : variants)
+						if (!strcmp(k.Name, name)) return k;
+				return variants.back();
+			}();
+			return kernels;
+		}
+
+		static const char* Name() {
+			return Kernels().Name;
+		}
+
+		static void Fill(uint32_t* dst, uint32_t value, size_t count) {
+			if (count < 8) return SpanScalar::Fill(dst, value, count);
+			Kernels().Fill(dst, value, count);
+		}
+
+		static void Copy(uint32_t* dst, const uint32_t* src, size_t count) {
+			Kernels().Copy(dst, src, count);
+		}
+
+		static void Stream(uint8_t* dst, const uint8_t* src, size_t bytes) {
+			Kernels().Stream(dst, src, bytes);
+		}
+
+		static void Flush() {
+#if defined(EASY_SPAN_SSE2)
+			_mm_sfence();
+#endif
+		}
+
+		static void Blend(uint32_t* dst, uint32_t value, uint8_t alpha, size_t count) {
+			if (count < 4) return SpanScalar::Blend(dst, value, alpha, count);
+			Kernels().Blend(dst, value, alpha, count);
+		}
+
+		static void Lerp(uint32_t* dst, const uint32_t* from, const uint32_t* to, uint8_t t, size_t count) {
+			if (count < 4) return SpanScalar::Lerp(dst, from, to, t, count);
+			Kernels().Lerp(dst, from, to, t, count);
+		}
+
+		static void Scale(uint32_t* dst, const uint32_t* src, uint8_t k, size_t count) {
+			if (count < 4) return SpanScalar::Scale(dst, src, k, count);
+			Kernels().Scale(dst, src, k, count);
+		}
+
+		static uint8_t Scale(unsigned value, unsigned k) {
+			return SpanScalar::Div255(value * k);
+		}
+
+		static uint32_t Lerp(uint32_t from, uint32_t to, uint8_t t) {
+			uint32_t result;
+			Lerp(&result, &from, &to, t, 1);
+			return result;
+		}
+
+		static bool SelfTest(const SpanKernels& kernels) {
+			const SpanKernels& reference = Variants().front();
+			uint32_t seed = 1;
+			auto next = [&seed]() { return seed = seed * 1664525u + 1013904223u; };
+			std::vector<uint32_t> from(256), to(256), initial(256);
+			for (size_t i = 0; i < initial.size(); ++i) from[i] = next(), to[i] = next(), initial[i] = next();
+			for (size_t offset = 0; offset < 4; ++offset) {
+				for (size_t count = 0; count + offset <= 200; count += count < 40 ? 1 : 7) {
+					uint32_t value = next();
+					uint8_t t = count % 3 == 0 ? 0 : count % 3 == 1 ? 255 : static_cast<uint8_t>(next());
+					auto same = [&](auto&& run) {
+						std::vector<uint32_t> expected = initial, actual = initial;
+						run(reference, expected.data() + offset);
+						run(kernels, actual.data() + offset);
+						return expected == actual;
+					};
+					bool passed =
+						same([&](const SpanKernels& k, uint32_t* dst) { k.Fill(dst, value, count); }) &&
+						same([&](const SpanKernels& k, uint32_t* dst) { k.Copy(dst, from.data() + 1, count); }) &&
+						same([&](const SpanKernels& k, uint32_t* dst) {
+							k.Stream(reinterpret_cast<uint8_t*>(dst) + 1, reinterpret_cast<const uint8_t*>(from.data()) + 3, count * 4);
+						}) &&
+						same([&](const SpanKernels& k, uint32_t* dst) { k.Blend(dst, value, t, count); }) &&
+						same([&](const SpanKernels& k, uint32_t* dst) { k.Lerp(dst, from.data() + 2, to.data() + offset, t, count); }) &&
+						same([&](const SpanKernels& k, uint32_t* dst) { k.Scale(dst, from.data() + offset, t, count); });
+					if (!passed) return false;
+				}
+			}
+			Flush();
+			return true;
+		}
+
+	};
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef SPATIAL_INDEX_HH_
+#define SPATIAL_INDEX_HH_
+
+#include "Element.hh"
+#include <vector>
+
+namespace easy {
+
+	struct SpatialIndex {
+		static constexpr int CellSize = 32;
+
+		struct Entry {
+			const Element* slot;
+			Rect rect;
+			unsigned stamp;
+		};
+
+	private:
+		std::vector<Entry> entries;
+		std::vector<std::vector<unsigned>> cells;
+		Rect area = {};
+		int cols = 0;
+		int rows = 0;
+		unsigned stamp = 0;
+		bool valid = false;
+
+		Rect Cover(Rect r) const {
+			return {
+				std::min(std::max(0, (r.Left - area.Left) / CellSize), cols - 1),
+				std::min(std::max(0, (r.Top - area.Top) / CellSize), rows - 1),
+				std::min(std::max(0, (r.Right - area.Left) / CellSize), cols - 1),
+				std::min(std::max(0, (r.Bottom - area.Top) / CellSize), rows - 1)
+			};
+		}
+
+		void Insert(unsigned id) {
+			Rect c = Cover(entries[id].rect);
+			for (int y = c.Top; y <= c.Bottom; ++y)
+				for (int x = c.Left; x <= c.Right; ++x)
+					cells[y * cols + x].push_back(id);
+		}
+
+		void Erase(unsigned id) {
+			Rect c = Cover(entries[id].rect);
+			for (int y = c.Top; y <= c.Bottom; ++y)
+				for (int x = c.Left; x <= c.Right; ++x) {
+					std::vector<unsigned>& cell = cells[y * cols + x];
+					for (unsigned& i : cell)
+						if (i == id) {
+							i = cell.back();
+							cell.pop_back();
+							break;
+						}
+				}
+		}
+
+	public:
+		bool Valid() const {
+			return valid;
+		}
+
+		void Invalidate() {
+			valid = false;
+		}
+
+		template<typename F>
+		void Update(Rect bounds, F&& enumerate) {
+			size_t count = 0;
+			bool rebuild = !valid || bounds != area;
+			if (!rebuild) {
+				enumerate([&](const Element* slot) {
+					if (count >= entries.size() || entries[count].slot != slot) rebuild = true;
+					else if (!rebuild && entries[count].rect != (*slot)->Reach()) {
+						Erase(static_cast<unsigned>(count));
+						entries[count].rect = (*slot)->Reach();
+						Insert(static_cast<unsigned>(count));
+					}
+					++count;
+				});
+				rebuild = rebuild || count != entries.size();
+			}
+			if (!rebuild) return;
+			area = bounds;
+			cols = std::max(1, (bounds.Right - bounds.Left + CellSize - 1) / CellSize);
+			rows = std::max(1, (bounds.Bottom - bounds.Top + CellSize - 1) / CellSize);
+			cells.resize(static_cast<size_t>(cols) * rows);
+			for (auto& cell : cells) cell.clear();
+			entries.clear();
+			enumerate([&](const Element* slot) {
+				entries.push_back(Entry{ slot, (*slot)->Reach(), 0 });
+				Insert(static_cast<unsigned>(entries.size() - 1));
+			});
+			valid = true;
+		}
+
+		template<typename F>
+		void Query(Pos pos, int radius, F&& visit) {
+			if (++stamp == 0) {
+				for (Entry& entry : entries) entry.stamp = 0;
+				stamp = 1;
+			}
+			Rect c = Cover({ pos.X - radius, pos.Y - radius, pos.X + radius, pos.Y + radius });
+			for (int y = c.Top; y <= c.Bottom; ++y)
+				for (int x = c.Left; x <= c.Right; ++x)
+					for (unsigned id : cells[y * cols + x]) {
+						Entry& entry = entries[id];
+						if (entry.stamp == stamp) continue;
+						entry.stamp = stamp;
+						visit(id, entry);
+					}
+		}
+
+		std::pair<const Element*, int> Pick(Pos pos) {
+			std::pair<const Element*, int> best = std::make_pair(nullptr, MouseTargetThreshold + 1);
+			unsigned order = 0;
+			Query(pos, MouseTargetThreshold, [&](unsigned id, const Entry& entry) {
+				int reach = entry.rect.Distance(pos);
+				if (reach > best.second || (reach == best.second && (!best.first || id > order))) return;
+				auto hit = (*entry.slot)->Pick(pos);
+				if (hit.second < best.second || (hit.second == best.second && best.first && id < order))
+					best = std::make_pair(hit.first ? hit.first : entry.slot, hit.second), order = id;
+			});
+			return best;
+		}
+	};
+
+}
+
+#endif
@@ -83,6 +83,11 @@ namespace easy {
 			}
 		}
 
+		static bool Next(std::chrono::steady_clock::time_point& deadline) {
+			if (instance().q.empty()) return false;
+			deadline = instance().q.top()->next;
+			return true;
+		}
 		
 		template<typename F, typename ... T>
 		static TimerHandle DelayInvoke(unsigned delay, F&& f, T&&... args) {
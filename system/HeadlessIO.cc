@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "include/PixelFormat.hh"
+#include "SystemIO.hh"
+
+
+struct HeadlessRender {
+public:
+	friend struct RenderImpl;
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Input {
+		Clock::time_point time;
+		int status, x, y;
+	};
+
+	int width = 800, height = 480;
+	easy::PixelFormat format = easy::PixelFormat::BGRA8888;
+	int bytes = 4;
+	std::vector<uint8_t> mbp;
+	std::vector<Input> script;
+	size_t next_input = 0;
+	std::string dump_prefix;
+	bool dump_raw = false;
+	unsigned long long frames = 0;
+	unsigned long long max_frames = 0;
+	int mouse_click_status[3] = {};
+	int mouse_move_status[3] = {};
+
+	HeadlessRender() {
+		if (const char* size = getenv("EASY_HEADLESS_SIZE")) {
+			if (sscanf(size, "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0)
+				printf("Error: Invalid EASY_HEADLESS_SIZE '%s', expected WIDTHxHEIGHT\n", size), exit(1);
+		}
+		if (const char* prefix = getenv("EASY_HEADLESS_DUMP")) dump_prefix = prefix;
+		if (const char* format = getenv("EASY_HEADLESS_FORMAT")) dump_raw = !strcmp(format, "raw");
+		if (const char* limit = getenv("EASY_HEADLESS_FRAMES")) max_frames = strtoull(limit, nullptr, 10);
+		if (const char* pixel = getenv("EASY_HEADLESS_PIXEL")) select_format(pixel);
+		if (const char* path = getenv("EASY_HEADLESS_INPUT")) load_script(path);
+		mbp.assign(static_cast<size_t>(width) * height * bytes, 0);
+	}
+
+	static HeadlessRender& instance() {
+		static HeadlessRender content;
+		return content;
+	}
+
+	void select_format(const char* pixel) {
+		const struct { const char* name; easy::PixelFormat format; int bytes; } formats[] = {
+			{ "bgra8888", easy::PixelFormat::BGRA8888, 4 },
+			{ "rgba8888", easy::PixelFormat::RGBA8888, 4 },
+			{ "rgb565", easy::PixelFormat::RGB565, 2 },
+			{ "bgr888", easy::PixelFormat::BGR888, 3 },
+		};
+		for (const auto& f : formats) {
+			if (!strcmp(pixel, f.name)) {
+				format = f.format, bytes = f.bytes;
+				return;
+			}
+		}
+		printf("Error: Unknown EASY_HEADLESS_PIXEL '%s'\n", pixel), exit(1);
+	}
+
+	void unpack(const uint8_t* src, uint8_t* rgb) const {
+		switch (format) {
+		case easy::PixelFormat::RGBA8888:
+			rgb[0] = src[0], rgb[1] = src[1], rgb[2] = src[2];
+			break;
+		case easy::PixelFormat::RGB565: {
+			unsigned value = src[0] | src[1] << 8;
+			rgb[0] = (value >> 11) * 255 / 31;
+			rgb[1] = (value >> 5 & 0x3f) * 255 / 63;
+			rgb[2] = (value & 0x1f) * 255 / 31;
+			break;
+		}
+		default:
+			rgb[0] = src[2], rgb[1] = src[1], rgb[2] = src[0];
+			break;
+		}
+	}
+
+	void load_script(const char* path) {
+		FILE* file = fopen(path, "r");
+		if (!file) printf("Error: Fail to open input script %s\n", path), exit(1);
+		Clock::time_point start = Clock::now();
+		char line[256];
+		for (int lineno = 1; fgets(line, sizeof(line), file); ++lineno) {
+			char command[16] = {};
+			long ms = 0;
+			Input input = { start, 0, 0, 0 };
+			int fields = line[0] == '#' ? 0 : sscanf(line, "%ld %15s %d %d", &ms, command, &input.x, &input.y);
+			if (fields < 2) continue;
+			input.time = start + std::chrono::milliseconds(ms);
+			if (!strcmp(command, "quit")) input.status = -1;
+			else if (fields != 4)
+				printf("Error: Expected coordinates at %s:%d\n", path, lineno), exit(1);
+			else if (!strcmp(command, "press")) input.status = 2;
+			else if (!strcmp(command, "release")) input.status = 1;
+			else if (!strcmp(command, "move")) input.status = 0;
+			else printf("Error: Unknown command '%s' at %s:%d\n", command, path, lineno), exit(1);
+			script.push_back(input);
+		}
+		fclose(file);
+	}
+
+	void sync() {
+		if (!dump_prefix.empty()) dump();
+		if (++frames == max_frames) exit(0);
+	}
+
+	void dump() {
+		char path[1024];
+		snprintf(path, sizeof(path), "%s%05llu.%s", dump_prefix.c_str(), frames, dump_raw ? "raw" : "ppm");
+		FILE* file = fopen(path, "wb");
+		if (!file) printf("Error: Fail to write frame %s\n", path), exit(1);
+		if (dump_raw) {
+			fwrite(mbp.data(), 1, mbp.size(), file);
+		} else {
+			fprintf(file, "P6\n%d %d\n255\n", width, height);
+			std::vector<uint8_t> line(width * 3);
+			for (int j = 0; j < height; ++j) {
+				const uint8_t* src = mbp.data() + static_cast<size_t>(j) * width * bytes;
+				for (int i = 0; i < width; ++i)
+					unpack(src + i * bytes, &line[i * 3]);
+				fwrite(line.data(), 1, line.size(), file);
+			}
+		}
+		fclose(file);
+	}
+
+	void wait(long long deadline) {
+		Clock::time_point until = Clock::time_point::max();
+		if (deadline >= 0) until = Clock::time_point(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(deadline)));
+		if (next_input < script.size() && script[next_input].time < until) until = script[next_input].time;
+		if (until == Clock::time_point::max()) {
+			if (max_frames) printf("Error: Idle with no input left before frame %llu\n", max_frames), exit(1);
+			while (true) std::this_thread::sleep_for(std::chrono::hours(24));
+		}
+		std::this_thread::sleep_until(until);
+	}
+
+	int* check_mouse_click() {
+		mouse_click_status[0] = 0;
+		if (next_input < script.size() && script[next_input].time <= Clock::now()) {
+			const Input& input = script[next_input++];
+			if (input.status < 0) exit(0);
+			mouse_click_status[0] = input.status;
+			mouse_click_status[1] = input.x;
+			mouse_click_status[2] = input.y;
+		}
+		return mouse_click_status;
+	}
+
+};
+
+
+int RenderImpl::Width() {
+	return HeadlessRender::instance().width;
+}
+
+int RenderImpl::Height() {
+	return HeadlessRender::instance().height;
+}
+
+uint8_t* RenderImpl::Data() {
+	return HeadlessRender::instance().mbp.data();
+}
+
+int RenderImpl::Format() {
+	return static_cast<int>(HeadlessRender::instance().format);
+}
+
+int RenderImpl::Stride() {
+	HeadlessRender& render = HeadlessRender::instance();
+	return render.width * render.bytes;
+}
+
+int RenderImpl::Buffers() {
+	return 1;
+}
+
+bool RenderImpl::WaitVSync() {
+	return false;
+}
+
+double RenderImpl::RefreshRate() {
+	return 0;
+}
+
+void RenderImpl::Wait(long long deadline) {
+	HeadlessRender::instance().wait(deadline);
+}
+
+void RenderImpl::Render() {
+	HeadlessRender::instance().sync();
+}
+
+long long RenderImpl::Presented() {
+	return 0;
+}
+
+void RenderImpl::Damage(int left, int top, int right, int bottom) {}
+
+int* RenderImpl::MouseClick() {
+	return HeadlessRender::instance().check_mouse_click();
+}
+
+int* RenderImpl::MouseMove() {
+	return HeadlessRender::instance().mouse_move_status;
+}
@@ -0,0 +1,58 @@
+#ifndef PRESENT_HH_
+#define PRESENT_HH_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <cstdint>
+#include "include/Span.hh"
+
+struct PresentEngine {
+	uint8_t* shadow = nullptr;
+	long stride = 0;
+	long bytes = 0;
+	long long presented = 0;
+
+	PresentEngine() = default;
+	PresentEngine(const PresentEngine&) = delete;
+	PresentEngine& operator=(const PresentEngine&) = delete;
+
+	~PresentEngine() {
+		free(shadow);
+	}
+
+	void allocate(long stride, long height, long bytes) {
+		size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		size_t size = (static_cast<size_t>(stride) * height + page - 1) / page * page;
+		void* buffer = nullptr;
+		if (posix_memalign(&buffer, page, size)) printf("Error: Fail to allocate shadow buffer\n"), exit(1);
+		memset(buffer, 0, size);
+		free(shadow);
+		shadow = static_cast<uint8_t*>(buffer);
+		this->stride = stride;
+		this->bytes = bytes;
+	}
+
+	void copy(uint8_t* dst, long dst_stride, int left, int top, int right, int bottom) {
+		long row = (right - left) * bytes;
+		if (row <= 0 || bottom <= top) return;
+		const uint8_t* src = shadow + top * stride + left * bytes;
+		dst += top * dst_stride + left * bytes;
+		if (row == stride && dst_stride == stride)
+			easy::Span::Stream(dst, src, static_cast<size_t>(row) * (bottom - top));
+		else
+			for (int j = top; j < bottom; ++j, src += stride, dst += dst_stride)
+				easy::Span::Stream(dst, src, row);
+		easy::Span::Flush();
+		presented += row * (bottom - top);
+	}
+
+	long long take() {
+		long long result = presented;
+		presented = 0;
+		return result;
+	}
+};
+
+#endif
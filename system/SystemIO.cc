@@ -7,8 +7,14 @@
 #include <linux/fb.h>
 #include <sys/mman.h>
 #include <sys/ioctl.h>
+#include <sys/timerfd.h>
+#include <poll.h>
+#include <errno.h>
 #include <cstdint>
 #include <linux/input.h>
+#include <vector>
+#include "include/PixelFormat.hh"
+#include "Present.hh"
 #include "SystemIO.hh"
 
 
@@ -20,14 +26,28 @@ private:
 	fb_fix_screeninfo finfo = {};
 	long screensize = 0;
 	long width = 0, height = 0;
+	long stride = 0;
+	int format = -1;
+	int touch_x[2] = { 0, 1024 };
+	int touch_y[2] = { 0, 600 };
 	char* fbp = nullptr;
-	char* mbp = nullptr;
+	PresentEngine shadow;
+	long mapsize = 0;
+	bool flipping = false;
+	bool vsync = true;
+	int back = 0;
 	int fp = 0;
 	int fevent0 = 0;
 	int fmouse0 = 0;
+	int ftimer = 0;
 	int mouse_click_status[3] = {};
 	int mouse_move_status[3] = {};
 
+	struct Region {
+		int left, top, right, bottom;
+	};
+	std::vector<Region> damaged;
+
 	LinuxRender() {
 		fp = open("/dev/fb0", O_RDWR);
 		if (fp < 0) printf("Error: Fail to open device\n"), exit(1);
@@ -35,24 +55,37 @@ private:
 		if (fevent0 < 0) printf("Error: Fail to open device\n"), exit(1);
 		fmouse0 = open("/dev/input/mouse0", O_RDONLY | O_NONBLOCK);
 		if (fmouse0 < 0) printf("Error: Fail to open device\n"), exit(1);
+		ftimer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+		if (ftimer < 0) printf("Error: Fail to create timer\n"), exit(1);
 		if (ioctl(fp, FBIOGET_FSCREENINFO, &finfo)) printf("Error: Fail to read fixed infor\n"), exit(1);
 		if (ioctl(fp, FBIOGET_VSCREENINFO, &vinfo)) printf("Error: Fail to read variable info\n"), exit(1);
-		screensize = vinfo.xres * vinfo.yres * vinfo.bits_per_pixel / 8;
 		width = vinfo.xres;
 		height = vinfo.yres;
-		if (width != 800 || height != 480) printf("Error: Unexpected screeb size (%u, %u) instead of (800, 480)\n", width, height), exit(1);
-		if (vinfo.bits_per_pixel != 32) printf("Error: Unexpected bits per pixel %u instead of 32\n", vinfo.bits_per_pixel), exit(1);
-		fbp = (char*)mmap(0, screensize, PROT_READ | PROT_WRITE, MAP_SHARED, fp, 0);
+		screensize = finfo.line_length * height;
+		format = detect_format();
+		if (format < 0)
+			printf("Warning: Unsupported %u bpp pixel layout, converting from a 32 bpp shadow buffer\n", vinfo.bits_per_pixel);
+		flipping = format >= 0 && enable_flipping();
+		mapsize = flipping ? 2 * screensize : screensize;
+		fbp = (char*)mmap(0, mapsize, PROT_READ | PROT_WRITE, MAP_SHARED, fp, 0);
 		if (fbp == MAP_FAILED) printf("Error: Failed to map framebuffer to memory\n"), exit(1);
-		mbp = new char[screensize];
+		stride = format >= 0 ? finfo.line_length : width * 4;
+		if (flipping) back = 1;
+		else shadow.allocate(stride, height, format >= 0 ? vinfo.bits_per_pixel / 8 : 4);
+		calibrate_touch();
 	}
 
 	~LinuxRender() {
-		munmap(fbp, screensize);
+		if (flipping && back == 0) {
+			vinfo.yoffset = 0;
+			memcpy(fbp, fbp + screensize, screensize);
+			ioctl(fp, FBIOPAN_DISPLAY, &vinfo);
+		}
+		munmap(fbp, mapsize);
 		close(fp);
 		close(fevent0);
 		close(fmouse0);
-		delete[] mbp;
+		close(ftimer);
 	}
 
 	static LinuxRender& instance() {
@@ -60,9 +93,124 @@ private:
 		return content;
 	}
 
+	int detect_format() const {
+		auto layout = [this](unsigned bpp, unsigned red, unsigned green, unsigned blue, unsigned green_length) {
+			return vinfo.bits_per_pixel == bpp &&
+				vinfo.red.offset == red && vinfo.green.offset == green && vinfo.blue.offset == blue &&
+				vinfo.green.length == green_length &&
+				vinfo.red.length == (bpp == 16 ? 5u : 8u) && vinfo.blue.length == (bpp == 16 ? 5u : 8u);
+		};
+		if (layout(32, 16, 8, 0, 8)) return static_cast<int>(easy::PixelFormat::BGRA8888);
+		if (layout(32, 0, 8, 16, 8)) return static_cast<int>(easy::PixelFormat::RGBA8888);
+		if (layout(16, 11, 5, 0, 6)) return static_cast<int>(easy::PixelFormat::RGB565);
+		if (layout(24, 16, 8, 0, 8)) return static_cast<int>(easy::PixelFormat::BGR888);
+		return -1;
+	}
+
+	void calibrate_touch() {
+		input_absinfo abs = {};
+		if (ioctl(fevent0, EVIOCGABS(ABS_X), &abs) == 0 && abs.maximum > abs.minimum)
+			touch_x[0] = abs.minimum, touch_x[1] = abs.maximum - abs.minimum + 1;
+		if (ioctl(fevent0, EVIOCGABS(ABS_Y), &abs) == 0 && abs.maximum > abs.minimum)
+			touch_y[0] = abs.minimum, touch_y[1] = abs.maximum - abs.minimum + 1;
+	}
+
+	bool enable_flipping() {
+		fb_var_screeninfo flip = vinfo;
+		flip.yres_virtual = vinfo.yres * 2;
+		flip.yoffset = 0;
+		if (ioctl(fp, FBIOPUT_VSCREENINFO, &flip) == 0 &&
+			ioctl(fp, FBIOGET_VSCREENINFO, &flip) == 0 &&
+			ioctl(fp, FBIOGET_FSCREENINFO, &finfo) == 0 &&
+			flip.yres_virtual >= vinfo.yres * 2 &&
+			finfo.smem_len >= 2 * finfo.line_length * vinfo.yres) {
+			vinfo = flip;
+			screensize = finfo.line_length * height;
+			return true;
+		}
+		ioctl(fp, FBIOPUT_VSCREENINFO, &vinfo);
+		ioctl(fp, FBIOGET_FSCREENINFO, &finfo);
+		return false;
+	}
+
+	bool wait_vsync() {
+		__u32 crtc = 0;
+		if (vsync && ioctl(fp, FBIO_WAITFORVSYNC, &crtc) == 0) return true;
+		vsync = false;
+		return false;
+	}
+
+	double refresh_rate() const {
+		if (!vinfo.pixclock) return 0;
+		double htotal = vinfo.xres + vinfo.left_margin + vinfo.right_margin + vinfo.hsync_len;
+		double vtotal = vinfo.yres + vinfo.upper_margin + vinfo.lower_margin + vinfo.vsync_len;
+		return 1e12 / (vinfo.pixclock * htotal * vtotal);
+	}
+
+	char* data() {
+		return flipping ? fbp + back * screensize : reinterpret_cast<char*>(shadow.shadow);
+	}
+
+	void damage(int left, int top, int right, int bottom) {
+		damaged.push_back(Region{ left, top, right, bottom });
+	}
+
+	bool flip() {
+		vinfo.yoffset = back * height;
+		if (ioctl(fp, FBIOPAN_DISPLAY, &vinfo) == 0) {
+			back ^= 1;
+			damaged.clear();
+			return true;
+		}
+		printf("Warning: FBIOPAN_DISPLAY failed, falling back to copying frames\n");
+		flipping = false;
+		shadow.allocate(stride, height, vinfo.bits_per_pixel / 8);
+		memcpy(shadow.shadow, fbp + back * screensize, screensize);
+		vinfo.yoffset = 0;
+		ioctl(fp, FBIOPAN_DISPLAY, &vinfo);
+		damaged.assign(1, Region{ 0, 0, static_cast<int>(width), static_cast<int>(height) });
+		return false;
+	}
+
+	static uint32_t channel(uint8_t value, const fb_bitfield& field) {
+		uint32_t bits = field.length > 8 ? static_cast<uint32_t>(value) << (field.length - 8) : value >> (8 - field.length);
+		return bits << field.offset;
+	}
+
+	void convert(const Region& r) {
+		long bytes = vinfo.bits_per_pixel / 8;
+		for (int j = r.top; j < r.bottom; ++j) {
+			const uint8_t* src = shadow.shadow + j * stride + r.left * 4L;
+			char* dst = fbp + j * finfo.line_length + r.left * bytes;
+			for (int i = r.left; i < r.right; ++i, src += 4, dst += bytes) {
+				uint32_t value = channel(src[2], vinfo.red) | channel(src[1], vinfo.green) | channel(src[0], vinfo.blue);
+				memcpy(dst, &value, bytes);
+			}
+		}
+		shadow.presented += (r.right - r.left) * bytes * (r.bottom - r.top);
+	}
+
 	void sync() {
-		memcpy(fbp, mbp, screensize);
-		memset(mbp, 0, screensize);
+		if (flipping && flip()) return;
+		for (const Region& r : damaged) {
+			if (format < 0) convert(r);
+			else shadow.copy(reinterpret_cast<uint8_t*>(fbp), finfo.line_length, r.left, r.top, r.right, r.bottom);
+		}
+		damaged.clear();
+	}
+
+	void wait(long long deadline) {
+		itimerspec spec = {};
+		if (deadline >= 0) {
+			spec.it_value.tv_sec = deadline / 1000000000;
+			spec.it_value.tv_nsec = deadline % 1000000000;
+			if (!deadline) spec.it_value.tv_nsec = 1;
+		}
+		timerfd_settime(ftimer, TFD_TIMER_ABSTIME, &spec, nullptr);
+		pollfd fds[2] = { { fevent0, POLLIN, 0 }, { ftimer, POLLIN, 0 } };
+		while (poll(fds, 2, -1) < 0 && errno == EINTR);
+		uint64_t expirations = 0;
+		if (read(ftimer, &expirations, sizeof(expirations)) < 0) expirations = 0;
 	}
 
 	int* check_mouse_click() {
@@ -70,8 +218,8 @@ private:
 		mouse_click_status[0] = 0;
 		while (read(fevent0, &ts, sizeof(ts)) >= 0) {
 			if (ts.type == EV_ABS) {
-				if (ts.code == ABS_X) mouse_click_status[1] = ts.value * 800 / 1024;
-				else if (ts.code == ABS_Y) mouse_click_status[2] = ts.value * 480 / 600;
+				if (ts.code == ABS_X) mouse_click_status[1] = (ts.value - touch_x[0]) * width / touch_x[1];
+				else if (ts.code == ABS_Y) mouse_click_status[2] = (ts.value - touch_y[0]) * height / touch_y[1];
 			} else if (ts.type == EV_KEY && ts.code == BTN_TOUCH) {
 				mouse_click_status[0] = ts.value + 1;
 			}
@@ -103,13 +251,46 @@ int RenderImpl::Height() {
 }
 
 uint8_t* RenderImpl::Data() {
-	return reinterpret_cast<uint8_t*>(LinuxRender::instance().mbp);
+	return reinterpret_cast<uint8_t*>(LinuxRender::instance().data());
+}
+
+int RenderImpl::Format() {
+	LinuxRender& render = LinuxRender::instance();
+	return render.format < 0 ? static_cast<int>(easy::PixelFormat::BGRA8888) : render.format;
+}
+
+int RenderImpl::Stride() {
+	return LinuxRender::instance().stride;
+}
+
+int RenderImpl::Buffers() {
+	return LinuxRender::instance().flipping ? 2 : 1;
+}
+
+bool RenderImpl::WaitVSync() {
+	return LinuxRender::instance().wait_vsync();
+}
+
+double RenderImpl::RefreshRate() {
+	return LinuxRender::instance().refresh_rate();
+}
+
+void RenderImpl::Wait(long long deadline) {
+	LinuxRender::instance().wait(deadline);
 }
 
 void RenderImpl::Render() {
 	LinuxRender::instance().sync();
 }
 
+long long RenderImpl::Presented() {
+	return LinuxRender::instance().shadow.take();
+}
+
+void RenderImpl::Damage(int left, int top, int right, int bottom) {
+	LinuxRender::instance().damage(left, top, right, bottom);
+}
+
 int* RenderImpl::MouseClick() {
 	return LinuxRender::instance().check_mouse_click();
 }
@@ -121,11 +302,13 @@ int* RenderImpl::MouseMove() {
 #else
 #if defined(_WIN32) || defined(WIN32) || defined(WIN64)
 
+#include "include/PixelFormat.hh"
 #include "SystemIO.hh"
 #include "windows/resource.h"
 #include "windows/framework.h"
 #include <Windows.h>
 #include <cstdio>
+#include <chrono>
 
 #if 1
 #pragma comment( linker, "/subsystem:\"windows\" /entry:\"mainCRTStartup\"" )
@@ -377,9 +560,45 @@ uint8_t* RenderImpl::Data() {
     return reinterpret_cast<uint8_t*>(WinRender::instance().content);
 }
 
-void RenderImpl::Render() {
-    StretchBlt(WinRender::instance().hdc, 0, 0, 800, 480, WinRender::instance().mdc, 0, 479, 800, -480, SRCCOPY);
-    memset(WinRender::instance().content, 0, WinRender::instance().bmi.bmiHeader.biSizeImage);
+int RenderImpl::Format() {
+    return static_cast<int>(easy::PixelFormat::BGRA8888);
+}
+
+int RenderImpl::Stride() {
+    return 800 * 4;
+}
+
+int RenderImpl::Buffers() {
+    return 1;
+}
+
+bool RenderImpl::WaitVSync() {
+    return false;
+}
+
+double RenderImpl::RefreshRate() {
+    return 0;
+}
+
+void RenderImpl::Wait(long long deadline) {
+    DWORD timeout = INFINITE;
+    if (deadline >= 0) {
+        long long now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        timeout = deadline > now ? static_cast<DWORD>((deadline - now + 999999) / 1000000) : 0;
+    }
+    MsgWaitForMultipleObjectsEx(0, nullptr, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+}
+
+void RenderImpl::Render() {}
+
+long long RenderImpl::Presented() {
+    return 0;
+}
+
+void RenderImpl::Damage(int left, int top, int right, int bottom) {
+    StretchBlt(WinRender::instance().hdc, left, top, right - left, bottom - top,
+               WinRender::instance().mdc, left, 479 - top, right - left, top - bottom, SRCCOPY);
 }
 
 int* RenderImpl::MouseClick() {
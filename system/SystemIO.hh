@@ -7,7 +7,15 @@ struct RenderImpl {
     static int Width();
 	static int Height();
 	static uint8_t* Data();
+	static int Format();
+	static int Stride();
+	static int Buffers();
+	static bool WaitVSync();
+	static double RefreshRate();
+	static void Wait(long long deadline);
 	static void Render();
+	static long long Presented();
+	static void Damage(int left, int top, int right, int bottom);
     static int* MouseClick();
     static int* MouseMove();
 };
@@ -15,7 +23,15 @@ struct RenderImpl {
 template<typename T>
 void Register() {
     T::RegisterRender(RenderImpl::Render);
+    T::RegisterPresented(RenderImpl::Presented);
     T::RegisterData(RenderImpl::Data);
+    T::RegisterFormat(RenderImpl::Format);
+    T::RegisterStride(RenderImpl::Stride);
+    T::RegisterDamage(RenderImpl::Damage);
+    T::RegisterBuffers(RenderImpl::Buffers);
+    T::RegisterWaitVSync(RenderImpl::WaitVSync);
+    T::RegisterRefreshRate(RenderImpl::RefreshRate);
+    T::RegisterWait(RenderImpl::Wait);
     int width = RenderImpl::Width();
     int height = RenderImpl::Height();
     T::RegisterSize(width, height);